@@ -0,0 +1,925 @@
+/**
+ * @file
+ *
+ * Benchmark of the GPIO expander driver core.  Every public gpioExpander_* function, except for the
+ * unimplemented gpioExpander_SetHighZ(), is run against the SX1509 simulator and for each one the
+ * latency distribution, the I2C transactions and bytes per call and the number of system calls the
+ * i2c-dev transport would have made per call are reported.  No hardware is required, so the
+ * benchmark can be run on a localhost target to get a baseline before changing gpioExpander.c and
+ * to catch regressions afterwards.
+ *
+ * Usage: gpioExpanderBench [iterations] [bus speed in Hz]
+ *
+ * A bus speed of 0 removes the emulated bus time so that only the software overhead is measured.
+ *
+ * Three more simulated expanders, on buses of their own as on the Green board, are brought up with
+ * and without deferred writes, and one of them is serviced by an interrupt thread.  The handlers of
+ * the interrupt thread are called from the event loop, which the benchmark doesn't run, so only the
+ * servicing of the interrupt in the thread is measured.
+ *
+ * The last benchmarks publish the state of the simulated expander in the shared memory page of the
+ * service, see gpioExpanderStatePage.h, so the benchmark must not be run alongside the service.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc. Use of this work is subject to license.
+ */
+
+#include "legato.h"
+#include "gpioExpander.h"
+#include "gpioExpanderTransport.h"
+#include "gpioExpanderStatePage.h"
+#include "sx1509Sim.h"
+#include <sys/mman.h>
+
+#define BENCH_DEFAULT_ITERATIONS 1000
+#define BENCH_MAX_ITERATIONS     10000
+#define BENCH_DEFAULT_BUS_HZ     400000
+
+#define BENCH_I2C_BUS  0
+#define BENCH_I2C_ADDR 0x3E
+
+// Pins used by the benchmark
+#define BENCH_OUTPUT_PIN 3
+#define BENCH_INPUT_PIN  9
+#define BENCH_SPARE_PIN  12
+
+// Keypad of two rows, on GPIOs 0 and 1, and one column, on GPIO 8
+#define BENCH_KEYPAD_ROWS    2
+#define BENCH_KEYPAD_COLUMNS 1
+
+// Handlers registered by the setup of a benchmark, which are removed before the next one
+#define BENCH_MAX_SETUP_HANDLERS 4
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A single benchmarked operation.  The iteration number is passed so that operations can alternate
+ * their arguments and not only measure writes which the driver can skip.  The optional setup
+ * function runs after the common setup and is not measured.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const char *name;
+    void (*op)(uint32_t iteration);
+    void (*setup)(void);
+} Benchmark_t;
+
+static gpioExpander_Identifier_t Expander =
+{
+    .i2cBus = BENCH_I2C_BUS,
+    .i2cAddr = BENCH_I2C_ADDR,
+};
+
+// Note: will be zeroed by spec, so no need to explicitly initialize the values
+static gpioExpander_HandlerRecord_t HandlerRecords[16];
+
+static struct
+{
+    uint8_t pin;
+    gpioExpander_ChangeCallbackRef_t ref;
+} SetupHandlers[BENCH_MAX_SETUP_HANDLERS];
+static int NumSetupHandlers;
+
+// Expanders on three buses, the second of which is serviced by the interrupt thread
+static gpioExpander_Identifier_t BusExpanders[3] =
+{
+    { .i2cBus = BENCH_I2C_BUS + 1, .i2cAddr = BENCH_I2C_ADDR },
+    { .i2cBus = BENCH_I2C_BUS + 2, .i2cAddr = BENCH_I2C_ADDR },
+    { .i2cBus = BENCH_I2C_BUS + 3, .i2cAddr = BENCH_I2C_ADDR },
+};
+#define BENCH_THREAD_EXPANDER (&BusExpanders[1])
+
+static gpioExpander_HandlerRecord_t ThreadHandlerRecords[16];
+static le_sem_Ref_t ThreadRequestSem;
+static le_sem_Ref_t ThreadDoneSem;
+
+static uint64_t Latencies[BENCH_MAX_ITERATIONS];
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Services the interrupt of the simulated expander.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ExpanderInterruptHandler
+(
+    void *contextPtr
+)
+{
+    gpioExpander_GenericInterruptHandler(&Expander, HandlerRecords);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Services the interrupt of the simulated expander with the time of the interrupt given.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ExpanderTimedInterruptHandler
+(
+    void *contextPtr
+)
+{
+    gpioExpander_TimedInterruptHandler(&Expander, HandlerRecords, gpioExpander_GetTimestampUs());
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hands the interrupt of the expander of the interrupt thread to the thread, and waits until it
+ * has been serviced.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ThreadExpanderInterruptHandler
+(
+    void *contextPtr
+)
+{
+    le_sem_Post(ThreadRequestSem);
+    le_sem_Wait(ThreadDoneSem);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Services the interrupts handed over by ThreadExpanderInterruptHandler().  Runs in the interrupt
+ * thread for as long as the benchmark does.
+ */
+//--------------------------------------------------------------------------------------------------
+static void BindThreadInterrupt
+(
+    gpioExpander_InterruptThreadRef_t thread,
+    void *contextPtr
+)
+{
+    le_sem_Post(ThreadDoneSem);
+    for (;;)
+    {
+        le_sem_Wait(ThreadRequestSem);
+        gpioExpander_ServiceInterruptThread(thread);
+        le_sem_Post(ThreadDoneSem);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Change event handler for the input pin.
+ */
+//--------------------------------------------------------------------------------------------------
+static void InputChangeHandler
+(
+    bool state,
+    void *contextPtr
+)
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Change event handler with the time of the change.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TimedChangeHandler
+(
+    bool state,
+    uint64_t timestampUs,
+    void *contextPtr
+)
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Key press handler of the keypad.
+ */
+//--------------------------------------------------------------------------------------------------
+static void KeyHandler
+(
+    uint8_t row,
+    uint8_t column,
+    void *contextPtr
+)
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Rising edge handler for the spare pin.  Every rising edge leaves the pin active, even if it has
+ * already changed back by the time the driver reads it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SpareRisingHandler
+(
+    bool state,
+    void *contextPtr
+)
+{
+    LE_FATAL_IF(!state, "Rising edge of GPIO %d reported as inactive", BENCH_SPARE_PIN);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Port change handler for the spare pin.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SparePortChangeHandler
+(
+    uint16_t changedMask,
+    uint16_t values,
+    uint64_t timestampUs,
+    void *contextPtr
+)
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Keeps a handler registered by a setup function so that it is removed before the next benchmark.
+ */
+//--------------------------------------------------------------------------------------------------
+static void KeepSetupHandler
+(
+    uint8_t pin,
+    gpioExpander_ChangeCallbackRef_t ref
+)
+{
+    LE_FATAL_IF(ref == NULL, "Couldn't add a handler to GPIO %d", pin);
+    LE_ASSERT(NumSetupHandlers < BENCH_MAX_SETUP_HANDLERS);
+    SetupHandlers[NumSetupHandlers].pin = pin;
+    SetupHandlers[NumSetupHandlers].ref = ref;
+    NumSetupHandlers++;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Benchmarked operations
+//--------------------------------------------------------------------------------------------------
+
+static gpioExpander_Polarity_t AlternatePolarity(uint32_t i)
+{
+    return (i & 1) ? GPIO_EXPANDER_ACTIVE_LOW : GPIO_EXPANDER_ACTIVE_HIGH;
+}
+
+static void OpSetInput(uint32_t i)
+{
+    gpioExpander_SetInput(&Expander, BENCH_SPARE_PIN, AlternatePolarity(i));
+}
+
+static void OpSetPushPullOutput(uint32_t i)
+{
+    gpioExpander_SetPushPullOutput(&Expander, BENCH_SPARE_PIN, AlternatePolarity(i), i & 1);
+}
+
+static void OpSetTriStateOutput(uint32_t i)
+{
+    gpioExpander_SetTriStateOutput(&Expander, BENCH_SPARE_PIN, AlternatePolarity(i));
+}
+
+static void OpSetOpenDrainOutput(uint32_t i)
+{
+    gpioExpander_SetOpenDrainOutput(&Expander, BENCH_SPARE_PIN, AlternatePolarity(i), i & 1);
+}
+
+static void OpEnablePullUp(uint32_t i)
+{
+    if (i & 1)
+    {
+        gpioExpander_EnablePullUp(&Expander, BENCH_SPARE_PIN);
+    }
+    else
+    {
+        gpioExpander_DisableResistors(&Expander, BENCH_SPARE_PIN);
+    }
+}
+
+static void OpEnablePullDown(uint32_t i)
+{
+    if (i & 1)
+    {
+        gpioExpander_EnablePullDown(&Expander, BENCH_SPARE_PIN);
+    }
+    else
+    {
+        gpioExpander_DisableResistors(&Expander, BENCH_SPARE_PIN);
+    }
+}
+
+static void OpDisableResistors(uint32_t i)
+{
+    gpioExpander_DisableResistors(&Expander, BENCH_SPARE_PIN);
+}
+
+static void OpActivateDeactivate(uint32_t i)
+{
+    if (i & 1)
+    {
+        gpioExpander_Activate(&Expander, BENCH_OUTPUT_PIN);
+    }
+    else
+    {
+        gpioExpander_Deactivate(&Expander, BENCH_OUTPUT_PIN);
+    }
+}
+
+static void OpRead(uint32_t i)
+{
+    gpioExpander_Read(&Expander, BENCH_INPUT_PIN);
+}
+
+static void OpReadPort(uint32_t i)
+{
+    uint16_t value;
+    gpioExpander_ReadPort(&Expander, &value);
+}
+
+static void OpWritePort(uint32_t i)
+{
+    gpioExpander_WritePort(&Expander, (1 << BENCH_OUTPUT_PIN), (i & 1) << BENCH_OUTPUT_PIN);
+}
+
+static void OpConfigurePins(uint32_t i)
+{
+    // All pins of the upper nibble of each bank, leaving the output and input pins alone
+    const uint16_t mask = 0xF0F0;
+    gpioExpander_PinConfig_t configs[16];
+    for (int pin = 0; pin < NUM_ARRAY_MEMBERS(configs); pin++)
+    {
+        configs[pin] = (gpioExpander_PinConfig_t)
+        {
+            .mode = (i & 1) ? GPIO_EXPANDER_PIN_MODE_PUSH_PULL_OUTPUT : GPIO_EXPANDER_PIN_MODE_INPUT,
+            .polarity = AlternatePolarity(i),
+            .value = (i & 1),
+            .pull = (i & 1) ? GPIO_EXPANDER_PULL_OFF : GPIO_EXPANDER_PULL_UP,
+            .edge = GPIO_EXPANDER_EDGE_NONE,
+        };
+    }
+    gpioExpander_ConfigurePins(&Expander, mask, configs);
+}
+
+static void OpAddRemoveChangeEventHandler(uint32_t i)
+{
+    gpioExpander_HandlerRecord_t *record = &HandlerRecords[BENCH_SPARE_PIN];
+    gpioExpander_ChangeCallbackRef_t ref = gpioExpander_AddChangeEventHandler(
+        &Expander,
+        BENCH_SPARE_PIN,
+        record,
+        GPIO_EXPANDER_EDGE_BOTH,
+        InputChangeHandler,
+        NULL,
+        0);
+    gpioExpander_RemoveChangeEventHandler(&Expander, BENCH_SPARE_PIN, record, ref);
+}
+
+static void OpAddRemovePortChangeHandler(uint32_t i)
+{
+    gpioExpander_AddPortChangeHandler(
+        &Expander, (1 << BENCH_SPARE_PIN), GPIO_EXPANDER_EDGE_BOTH, SparePortChangeHandler, NULL);
+    gpioExpander_RemovePortChangeHandler(&Expander);
+
+    // The spare pin is no longer watched, so its change must not be reported along with the
+    // interrupt of the input pin
+    const uint16_t inputs = (i & 1) ? ~((1 << BENCH_SPARE_PIN) | (1 << BENCH_INPUT_PIN)) : 0xFFFF;
+    sx1509Sim_SetInputs(BENCH_I2C_BUS, BENCH_I2C_ADDR, inputs ^ (1 << BENCH_SPARE_PIN));
+    sx1509Sim_SetInputs(
+        BENCH_I2C_BUS, BENCH_I2C_ADDR, inputs ^ (1 << BENCH_SPARE_PIN) ^ (1 << BENCH_INPUT_PIN));
+}
+
+static void OpSetEdgeSense(uint32_t i)
+{
+    gpioExpander_SetEdgeSense(
+        &Expander, BENCH_INPUT_PIN, (i & 1) ? GPIO_EXPANDER_EDGE_RISING : GPIO_EXPANDER_EDGE_BOTH);
+}
+
+static void OpGetEdgeSense(uint32_t i)
+{
+    gpioExpander_GetEdgeSense(&Expander, BENCH_INPUT_PIN);
+}
+
+static void OpDisableEdgeSense(uint32_t i)
+{
+    gpioExpander_DisableEdgeSense(&Expander, BENCH_SPARE_PIN);
+}
+
+static void OpIsOutput(uint32_t i)
+{
+    gpioExpander_IsOutput(&Expander, BENCH_OUTPUT_PIN);
+}
+
+static void OpIsInput(uint32_t i)
+{
+    gpioExpander_IsInput(&Expander, BENCH_INPUT_PIN);
+}
+
+static void OpGetPolarity(uint32_t i)
+{
+    gpioExpander_GetPolarity(&Expander, BENCH_INPUT_PIN);
+}
+
+static void OpIsActive(uint32_t i)
+{
+    gpioExpander_IsActive(&Expander, BENCH_OUTPUT_PIN);
+}
+
+static void OpGetPullUpDown(uint32_t i)
+{
+    gpioExpander_GetPullUpDown(&Expander, BENCH_INPUT_PIN);
+}
+
+static void OpReset(uint32_t i)
+{
+    gpioExpander_Reset(&Expander);
+}
+
+static void OpInterrupt(uint32_t i)
+{
+    // Toggling the input causes the simulator to assert NINT, which runs the generic handler
+    sx1509Sim_SetInputs(BENCH_I2C_BUS, BENCH_I2C_ADDR, (i & 1) ? 0xFFFF : ~(1 << BENCH_INPUT_PIN));
+}
+
+static void SetupRecoveredEdge(void)
+{
+    sx1509Sim_SetInputs(BENCH_I2C_BUS, BENCH_I2C_ADDR, ~(1 << BENCH_SPARE_PIN));
+    KeepSetupHandler(
+        BENCH_SPARE_PIN,
+        gpioExpander_AddChangeEventHandler(
+            &Expander,
+            BENCH_SPARE_PIN,
+            &HandlerRecords[BENCH_SPARE_PIN],
+            GPIO_EXPANDER_EDGE_RISING,
+            SpareRisingHandler,
+            NULL,
+            0));
+}
+
+static void OpRecoveredEdge(uint32_t i)
+{
+    // Every other rising edge, starting with the first, has already fallen again when DATA is read
+    if ((i & 1) == 0)
+    {
+        sx1509Sim_SetInputsOnClear(BENCH_I2C_BUS, BENCH_I2C_ADDR, ~(1 << BENCH_SPARE_PIN));
+        sx1509Sim_SetInputs(BENCH_I2C_BUS, BENCH_I2C_ADDR, 0xFFFF);
+    }
+    else
+    {
+        sx1509Sim_SetInputs(BENCH_I2C_BUS, BENCH_I2C_ADDR, 0xFFFF);
+        sx1509Sim_SetInputs(BENCH_I2C_BUS, BENCH_I2C_ADDR, ~(1 << BENCH_SPARE_PIN));
+    }
+}
+
+static void SetupPublishState(void)
+{
+    // A previous instance of the service which died in the middle of an update leaves a port odd
+    const int fd = shm_open(GPIO_EXPANDER_STATE_PAGE_NAME, O_RDWR | O_CREAT, 0644);
+    LE_FATAL_IF(fd < 0, "Couldn't open shared memory %s: %m", GPIO_EXPANDER_STATE_PAGE_NAME);
+    gpioExpanderStatePage_t *page = MAP_FAILED;
+    if (ftruncate(fd, sizeof(*page)) == 0)
+    {
+        page = mmap(NULL, sizeof(*page), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    LE_FATAL_IF(page == MAP_FAILED, "Couldn't map shared memory %s", GPIO_EXPANDER_STATE_PAGE_NAME);
+    page->ports[0].sequence |= 1;
+
+    LE_FATAL_IF(
+        gpioExpander_PublishState(&Expander, 1) != LE_OK, "Couldn't publish the GPIO state");
+    LE_FATAL_IF(
+        (page->ports[0].sequence & 1) != 0, "Published port left in the middle of an update");
+    munmap(page, sizeof(*page));
+}
+
+static void OpAddRemoveTimedChangeEventHandler(uint32_t i)
+{
+    gpioExpander_HandlerRecord_t *record = &HandlerRecords[BENCH_SPARE_PIN];
+    gpioExpander_ChangeCallbackRef_t ref = gpioExpander_AddTimedChangeEventHandler(
+        &Expander,
+        BENCH_SPARE_PIN,
+        record,
+        GPIO_EXPANDER_EDGE_BOTH,
+        TimedChangeHandler,
+        NULL,
+        0);
+    gpioExpander_RemoveChangeEventHandler(&Expander, BENCH_SPARE_PIN, record, ref);
+}
+
+static void SetupTimedInterrupt(void)
+{
+    sx1509Sim_SetInterruptHandler(
+        BENCH_I2C_BUS, BENCH_I2C_ADDR, ExpanderTimedInterruptHandler, NULL);
+}
+
+static void SetupInterruptStorm(void)
+{
+    // The input pin is throttled after its first 100 changes
+    gpioExpander_SetStormLimit(&Expander, 100);
+}
+
+static void OpSetStormLimit(uint32_t i)
+{
+    gpioExpander_SetStormLimit(&Expander, (i & 1) ? 0 : 200);
+}
+
+static void OpSetDebounce(uint32_t i)
+{
+    gpioExpander_SetDebounce(&Expander, BENCH_INPUT_PIN, i & 1);
+}
+
+static void OpSetDebounceTime(uint32_t i)
+{
+    gpioExpander_SetDebounceTime(&Expander, (i & 1) ? 4000 : 500);
+}
+
+static void OpIsDebounced(uint32_t i)
+{
+    gpioExpander_IsDebounced(&Expander, BENCH_INPUT_PIN);
+}
+
+static void OpSetLed(uint32_t i)
+{
+    const gpioExpander_LedConfig_t config =
+    {
+        .onIntensity = (i & 1) ? 255 : 128,
+        .offIntensity = 0,
+        .onTimeMs = 500,
+        .offTimeMs = 500,
+        .riseTimeMs = 260,
+        .fallTimeMs = 260,
+    };
+    gpioExpander_SetLed(&Expander, BENCH_SPARE_PIN, &config);
+}
+
+static void OpSetLedDisableLed(uint32_t i)
+{
+    if (i & 1)
+    {
+        gpioExpander_DisableLed(&Expander, BENCH_SPARE_PIN);
+    }
+    else
+    {
+        OpSetLed(i);
+    }
+}
+
+static le_result_t EnableKeypad(void)
+{
+    const gpioExpander_KeypadConfig_t config =
+    {
+        .rows = BENCH_KEYPAD_ROWS,
+        .columns = BENCH_KEYPAD_COLUMNS,
+        .scanTimeMs = 8,
+        .sleepTimeMs = 0,
+    };
+    return gpioExpander_EnableKeypad(&Expander, &config, KeyHandler, NULL);
+}
+
+static void OpEnableDisableKeypad(uint32_t i)
+{
+    if (i & 1)
+    {
+        gpioExpander_DisableKeypad(&Expander);
+    }
+    else
+    {
+        EnableKeypad();
+    }
+}
+
+static void SetupKeypad(void)
+{
+    LE_FATAL_IF(EnableKeypad() != LE_OK, "Couldn't enable the keypad");
+}
+
+static void OpKeyPress(uint32_t i)
+{
+    // The press asserts NINT, which runs the generic handler
+    sx1509Sim_PressKey(BENCH_I2C_BUS, BENCH_I2C_ADDR, i % BENCH_KEYPAD_ROWS, 0);
+}
+
+static void OpDeferFlushWrites(uint32_t i)
+{
+    gpioExpander_DeferWrites();
+    gpioExpander_WritePort(&Expander, (1 << BENCH_OUTPUT_PIN), (i & 1) << BENCH_OUTPUT_PIN);
+    gpioExpander_SetDebounce(&Expander, BENCH_INPUT_PIN, i & 1);
+    gpioExpander_FlushWrites();
+}
+
+static void SetupBusExpanders(void)
+{
+    for (int e = 0; e < NUM_ARRAY_MEMBERS(BusExpanders); e++)
+    {
+        sx1509Sim_SetInputs(BusExpanders[e].i2cBus, BusExpanders[e].i2cAddr, 0xFFFF);
+        gpioExpander_Reset(&BusExpanders[e]);
+    }
+}
+
+static void BringUpBusExpanders(uint32_t i)
+{
+    // The lower bank of each expander drives outputs and the upper one reads inputs
+    for (int e = 0; e < NUM_ARRAY_MEMBERS(BusExpanders); e++)
+    {
+        for (uint8_t pin = 0; pin < 16; pin++)
+        {
+            if (pin < 8)
+            {
+                gpioExpander_SetPushPullOutput(&BusExpanders[e], pin, AlternatePolarity(i), i & 1);
+            }
+            else
+            {
+                gpioExpander_SetInput(&BusExpanders[e], pin, AlternatePolarity(i));
+            }
+        }
+    }
+}
+
+static void OpBringUp(uint32_t i)
+{
+    BringUpBusExpanders(i);
+}
+
+static void OpDeferredBringUp(uint32_t i)
+{
+    gpioExpander_DeferWrites();
+    BringUpBusExpanders(i);
+    gpioExpander_FlushWrites();
+}
+
+static void SetupInterruptThread(void)
+{
+    const gpioExpander_Identifier_t *expander = BENCH_THREAD_EXPANDER;
+    ThreadRequestSem = le_sem_Create("benchIrqRequest", 0);
+    ThreadDoneSem = le_sem_Create("benchIrqDone", 0);
+    sx1509Sim_SetInputs(expander->i2cBus, expander->i2cAddr, 0xFFFF);
+    gpioExpander_Reset(expander);
+
+    gpioExpander_InterruptThreadRef_t thread = gpioExpander_CreateInterruptThread(
+        "benchInterrupt", LE_THREAD_PRIORITY_MEDIUM, expander, ThreadHandlerRecords);
+    LE_FATAL_IF(
+        gpioExpander_SetInput(expander, BENCH_INPUT_PIN, GPIO_EXPANDER_ACTIVE_HIGH) != LE_OK,
+        "Couldn't configure input pin");
+    LE_FATAL_IF(
+        gpioExpander_AddTimedChangeEventHandler(
+            expander,
+            BENCH_INPUT_PIN,
+            &ThreadHandlerRecords[BENCH_INPUT_PIN],
+            GPIO_EXPANDER_EDGE_BOTH,
+            TimedChangeHandler,
+            NULL,
+            0) == NULL,
+        "Couldn't add a handler to GPIO %d",
+        BENCH_INPUT_PIN);
+    sx1509Sim_SetInterruptHandler(
+        expander->i2cBus, expander->i2cAddr, ThreadExpanderInterruptHandler, NULL);
+    gpioExpander_StartInterruptThread(thread, BindThreadInterrupt, NULL);
+    le_sem_Wait(ThreadDoneSem);
+}
+
+static void OpInterruptThread(uint32_t i)
+{
+    const gpioExpander_Identifier_t *expander = BENCH_THREAD_EXPANDER;
+    sx1509Sim_SetInputs(
+        expander->i2cBus, expander->i2cAddr, (i & 1) ? 0xFFFF : ~(1 << BENCH_INPUT_PIN));
+}
+
+static void OpGetInterruptStats(uint32_t i)
+{
+    gpioExpander_InterruptStats_t stats;
+    gpioExpander_GetInterruptStats(&Expander, &stats);
+}
+
+static void OpDiscoverPrimaryI2cBusNum(uint32_t i)
+{
+    uint8_t busNum;
+    gpioExpander_DiscoverPrimaryI2cBusNum(&busNum);
+}
+
+static const Benchmark_t Benchmarks[] =
+{
+    { "SetInput",                       OpSetInput },
+    { "SetPushPullOutput",              OpSetPushPullOutput },
+    { "SetTriStateOutput",              OpSetTriStateOutput },
+    { "SetOpenDrainOutput",             OpSetOpenDrainOutput },
+    { "EnablePullUp",                   OpEnablePullUp },
+    { "EnablePullDown",                 OpEnablePullDown },
+    { "DisableResistors",               OpDisableResistors },
+    { "Activate/Deactivate",            OpActivateDeactivate },
+    { "Read",                           OpRead },
+    { "ReadPort",                       OpReadPort },
+    { "WritePort",                      OpWritePort },
+    { "ConfigurePins",                  OpConfigurePins },
+    { "Add/RemoveChangeEventHandler",   OpAddRemoveChangeEventHandler },
+    { "Add/RemovePortChangeHandler",    OpAddRemovePortChangeHandler },
+    { "SetEdgeSense",                   OpSetEdgeSense },
+    { "GetEdgeSense",                   OpGetEdgeSense },
+    { "DisableEdgeSense",               OpDisableEdgeSense },
+    { "IsOutput",                       OpIsOutput },
+    { "IsInput",                        OpIsInput },
+    { "GetPolarity",                    OpGetPolarity },
+    { "IsActive",                       OpIsActive },
+    { "GetPullUpDown",                  OpGetPullUpDown },
+    { "Reset",                          OpReset },
+    { "GenericInterruptHandler",        OpInterrupt },
+    { "TimedInterruptHandler",          OpInterrupt, SetupTimedInterrupt },
+    { "RecoveredRisingEdge",            OpRecoveredEdge, SetupRecoveredEdge },
+    { "Interrupt storm (100/s)",        OpInterrupt, SetupInterruptStorm },
+    { "SetStormLimit",                  OpSetStormLimit },
+    { "Add/RemoveTimedChangeHandler",   OpAddRemoveTimedChangeEventHandler },
+    { "GetInterruptStats",              OpGetInterruptStats },
+    { "DiscoverPrimaryI2cBusNum",       OpDiscoverPrimaryI2cBusNum },
+    { "SetDebounce",                    OpSetDebounce },
+    { "SetDebounceTime",                OpSetDebounceTime },
+    { "IsDebounced",                    OpIsDebounced },
+    { "SetLed",                         OpSetLed },
+    { "SetLed/DisableLed",              OpSetLedDisableLed },
+    { "EnableKeypad/DisableKeypad",     OpEnableDisableKeypad },
+    { "Key press",                      OpKeyPress, SetupKeypad },
+    { "DeferWrites/FlushWrites",        OpDeferFlushWrites },
+    { "Bring-up of 3 expanders",        OpBringUp, SetupBusExpanders },
+    { "Deferred bring-up of 3",         OpDeferredBringUp, SetupBusExpanders },
+
+    // The interrupt thread and the published state stay until the end, so these come last
+    { "Interrupt thread",               OpInterruptThread, SetupInterruptThread },
+    { "WritePort (published)",          OpWritePort, SetupPublishState },
+};
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Puts the simulated expander into a known configuration before each benchmark: one output, one
+ * input with a change event handler and one spare pin for the configuration functions.  The
+ * handlers of the previous benchmark are removed, so that they don't use up the pool of handlers.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Setup
+(
+    void
+)
+{
+    for (int i = 0; i < NumSetupHandlers; i++)
+    {
+        const uint8_t pin = SetupHandlers[i].pin;
+        gpioExpander_RemoveChangeEventHandler(
+            &Expander, pin, &HandlerRecords[pin], SetupHandlers[i].ref);
+    }
+    NumSetupHandlers = 0;
+
+    sx1509Sim_SetInterruptHandler(BENCH_I2C_BUS, BENCH_I2C_ADDR, ExpanderInterruptHandler, NULL);
+    sx1509Sim_SetInputs(BENCH_I2C_BUS, BENCH_I2C_ADDR, 0xFFFF);
+    gpioExpander_Reset(&Expander);
+
+    // The interrupts are raised faster than any storm limit, and must not be throttled
+    gpioExpander_SetStormLimit(&Expander, 0);
+
+    LE_FATAL_IF(
+        gpioExpander_SetPushPullOutput(
+            &Expander, BENCH_OUTPUT_PIN, GPIO_EXPANDER_ACTIVE_HIGH, false) != LE_OK,
+        "Couldn't configure output pin");
+    LE_FATAL_IF(
+        gpioExpander_SetInput(&Expander, BENCH_INPUT_PIN, GPIO_EXPANDER_ACTIVE_HIGH) != LE_OK,
+        "Couldn't configure input pin");
+    KeepSetupHandler(
+        BENCH_INPUT_PIN,
+        gpioExpander_AddChangeEventHandler(
+            &Expander,
+            BENCH_INPUT_PIN,
+            &HandlerRecords[BENCH_INPUT_PIN],
+            GPIO_EXPANDER_EDGE_BOTH,
+            InputChangeHandler,
+            NULL,
+            0));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the current time in nanoseconds from a monotonic clock.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t GetTimeNs
+(
+    void
+)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + now.tv_nsec;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Comparison function for sorting latencies.
+ */
+//--------------------------------------------------------------------------------------------------
+static int CompareLatencies
+(
+    const void *a,
+    const void *b
+)
+{
+    const uint64_t x = *(const uint64_t *)a;
+    const uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets a percentile from a sorted array of latencies.
+ *
+ * @return
+ *      The latency in microseconds
+ */
+//--------------------------------------------------------------------------------------------------
+static double Percentile
+(
+    const uint64_t *sorted,
+    uint32_t count,
+    uint32_t percent
+)
+{
+    const uint32_t index = ((count - 1) * percent) / 100;
+    return sorted[index] / 1000.0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Runs one benchmark and prints its results.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RunBenchmark
+(
+    const Benchmark_t *benchmark,
+    uint32_t iterations
+)
+{
+    Setup();
+    if (benchmark->setup != NULL)
+    {
+        benchmark->setup();
+    }
+    sx1509Sim_ResetStats();
+
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        const uint64_t start = GetTimeNs();
+        benchmark->op(i);
+        Latencies[i] = GetTimeNs() - start;
+    }
+
+    sx1509Sim_Stats_t stats;
+    sx1509Sim_GetStats(&stats);
+    qsort(Latencies, iterations, sizeof(Latencies[0]), CompareLatencies);
+
+    printf(
+        "%-30s %9.2f %9.2f %9.2f %9.2f %8.2f %8.2f %8.2f\n",
+        benchmark->name,
+        Percentile(Latencies, iterations, 50),
+        Percentile(Latencies, iterations, 90),
+        Percentile(Latencies, iterations, 99),
+        Latencies[iterations - 1] / 1000.0,
+        (double)stats.transactions / iterations,
+        (double)stats.bytes / iterations,
+        (double)stats.syscalls / iterations);
+}
+
+
+COMPONENT_INIT
+{
+    uint32_t iterations = BENCH_DEFAULT_ITERATIONS;
+    uint32_t busHz = BENCH_DEFAULT_BUS_HZ;
+    if (le_arg_NumArgs() >= 1)
+    {
+        iterations = strtoul(le_arg_GetArg(0), NULL, 0);
+    }
+    if (le_arg_NumArgs() >= 2)
+    {
+        busHz = strtoul(le_arg_GetArg(1), NULL, 0);
+    }
+    LE_FATAL_IF(
+        iterations == 0 || iterations > BENCH_MAX_ITERATIONS,
+        "Iterations must be between 1 and %d",
+        BENCH_MAX_ITERATIONS);
+
+    LE_FATAL_IF(
+        sx1509Sim_AddDevice(BENCH_I2C_BUS, BENCH_I2C_ADDR) != LE_OK,
+        "Couldn't create the simulated GPIO expander");
+    for (int e = 0; e < NUM_ARRAY_MEMBERS(BusExpanders); e++)
+    {
+        LE_FATAL_IF(
+            sx1509Sim_AddDevice(BusExpanders[e].i2cBus, BusExpanders[e].i2cAddr) != LE_OK,
+            "Couldn't create the simulated GPIO expander on bus %d",
+            BusExpanders[e].i2cBus);
+    }
+    sx1509Sim_SetBusSpeed(busHz);
+    LE_FATAL_IF(
+        gpioExpander_SetI2cTransport(sx1509Sim_GetTransport()) != LE_OK,
+        "Couldn't install the simulator I2C transport");
+
+    // Installing the transport discards the state of the expanders, so bind afterwards
+    gpioExpander_BindInterrupt(&Expander);
+
+    printf("GPIO expander benchmark: %u iterations, bus speed %u Hz\n", iterations, busHz);
+    printf(
+        "%-30s %9s %9s %9s %9s %8s %8s %8s\n",
+        "function", "p50 us", "p90 us", "p99 us", "max us", "xfer", "bytes", "syscall");
+    for (int i = 0; i < NUM_ARRAY_MEMBERS(Benchmarks); i++)
+    {
+        RunBenchmark(&Benchmarks[i], iterations);
+    }
+
+    shm_unlink(GPIO_EXPANDER_STATE_PAGE_NAME);
+    exit(EXIT_SUCCESS);
+}
@@ -20,1232 +20,5561 @@
 
 #include "legato.h"
 #include "gpioExpander.h"
+#include "gpioExpanderTransport.h"
+#include "sx1509Registers.h"
 #include "i2c-utils.h"
+#include "gpioExpanderStatePage.h"
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+
+typedef enum
+{
+    SX1509_DIRECTION_OUTPUT = 0,
+    SX1509_DIRECTION_INPUT = 1,
+} Sx1509_Direction_t;
+
+typedef enum
+{
+    SX1509_POLARITY_NORMAL = 0,
+    SX1509_POLARITY_INVERTED = 1,
+} Sx1509_Polarity_t;
+
+typedef enum
+{
+    GPIO_EXPANDER_OUTPUT_TYPE_PUSH_PULL,
+    GPIO_EXPANDER_OUTPUT_TYPE_OPEN_DRAIN,
+    GPIO_EXPANDER_OUTPUT_TYPE_TRISTATE,
+} gpioExpander_OutputType_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Oscillator source selection in bits 6:5 of RegClock.  The debounce engine is clocked from the
+ * oscillator, so it does nothing while the oscillator is off, which is the reset state.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_CLOCK_OSC_SOURCE_MASK     0x60
+#define SX1509_CLOCK_OSC_SOURCE_INTERNAL 0x40
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Debounce time selection in bits 2:0 of RegDebounceConfig.  Setting n selects 0.5 ms * 2^n with
+ * the 2 MHz internal oscillator.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_DEBOUNCE_TIME_MASK        0x07
+#define SX1509_DEBOUNCE_TIME_MIN_US      500
+#define SX1509_DEBOUNCE_TIME_MAX_SETTING 7
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * LED driver clock (ClkX) selection in bits 6:4 of RegMisc.  The driver runs the LED engine at
+ * fOSC / 8, which gives a PWM frequency of about 1 kHz and blink times in steps of 65 ms up to
+ * about 1 second.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_MISC_LED_CLOCK_MASK     0x70
+#define SX1509_MISC_LED_CLOCK_DIV8     0x40
+#define SX1509_LED_CLOCK_HZ            250000
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Bit 0 of RegMisc.  After reset, a read of RegData clears the events of its bank.  The interrupt
+ * handler clears the events it has seen itself, so this is disabled.  Otherwise an event latched
+ * between reading the status and reading the data, or before a client reads the port, would be
+ * lost.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_MISC_NO_AUTOCLEAR       0x01
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Encoding of the LED driver timing registers.  Settings 1 to 15 count in single units and settings
+ * 16 to 31 in larger units.  The unit of the on and off times is 64 cycles of the PWM period of
+ * 255 ClkX cycles.  The unit of the rise and fall times is one ClkX PWM period per intensity step.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_LED_TIME_MAX_SETTING    31
+#define SX1509_LED_TIME_UNIT_US        (64ULL * 255 * 1000000 / SX1509_LED_CLOCK_HZ)
+#define SX1509_LED_TIME_LONG_SCALE     8
+#define SX1509_LED_FADE_STEP_US        (255ULL * 1000000 / SX1509_LED_CLOCK_HZ)
+#define SX1509_LED_FADE_LONG_SCALE     16
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * RegOff holds the off time in bits 7:3 and the off intensity in bits 2:0, in steps of 4.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_LED_OFF_TIME_SHIFT      3
+#define SX1509_LED_OFF_INTENSITY_STEP  4
+#define SX1509_LED_OFF_INTENSITY_MAX   (7 * SX1509_LED_OFF_INTENSITY_STEP)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Offsets of the LED driver registers of a GPIO from its RegTOn.  Only GPIOs 4-7 and 12-15 have the
+ * rise and fall registers which are needed for breathing.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_LED_REG_T_ON            0
+#define SX1509_LED_REG_I_ON            1
+#define SX1509_LED_REG_OFF             2
+#define SX1509_LED_REG_T_RISE          3
+#define SX1509_LED_REG_T_FALL          4
+#define SX1509_LED_NUM_REGS            3
+#define SX1509_LED_NUM_REGS_BREATHING  5
+#define SX1509_LED_CAN_BREATHE(pin)    (((pin) & 0x4) != 0)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fields of RegKeyConfig1 and RegKeyConfig2.  The scan time per row is 1 ms * 2^n and the sleep
+ * time is 64 ms * 2^n, with a sleep setting of 0 meaning that the engine never sleeps.  The row and
+ * column counts are stored minus one, and a row setting of 0 turns the keypad engine off.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_KEY_SCAN_TIME_MASK      0x07
+#define SX1509_KEY_SCAN_TIME_MIN_MS    1
+#define SX1509_KEY_SLEEP_TIME_SHIFT    4
+#define SX1509_KEY_SLEEP_TIME_MASK     0x70
+#define SX1509_KEY_SLEEP_TIME_UNIT_MS  64
+#define SX1509_KEY_TIME_MAX_SETTING    7
+#define SX1509_KEY_ROWS_SHIFT          3
+#define SX1509_KEY_ROWS_MASK           0x38
+#define SX1509_KEY_COLUMNS_MASK        0x07
+#define SX1509_KEY_MIN_ROWS            2
+#define SX1509_KEY_MAX_LINES           8
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Polling of change events on an expander without a bound interrupt.  All polled GPIOs of the
+ * expander are sampled by one block read per period.  The period starts at the shortest sampleMs
+ * requested and doubles after every SX1509_POLL_IDLE_SAMPLES samples without a change, up to
+ * SX1509_POLL_MAX_BACKOFF times the shortest sampleMs or SX1509_POLL_MAX_PERIOD_MS, whichever is
+ * shorter.  A change returns it to the shortest sampleMs.  The period is never shorter than
+ * SX1509_POLL_MIN_PERIOD_MS, which bounds the bus load of a single expander.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_POLL_DEFAULT_MS     100
+#define SX1509_POLL_MIN_PERIOD_MS  5
+#define SX1509_POLL_MAX_PERIOD_MS  1000
+#define SX1509_POLL_MAX_BACKOFF    16
+#define SX1509_POLL_IDLE_SAMPLES   8
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Protection against interrupt storms.  A GPIO which reports more than the limit of events within
+ * one second is throttled: its interrupt is masked and its edge sense turned off, and it is polled
+ * every SX1509_STORM_POLL_MS instead.  It is handed back to the interrupt once it has been seen
+ * unchanged for SX1509_STORM_QUIET_MS.  The limit can be changed with gpioExpander_SetStormLimit().
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_STORM_DEFAULT_LIMIT 200
+#define SX1509_STORM_WINDOW_US     1000000
+#define SX1509_STORM_POLL_MS       50
+#define SX1509_STORM_QUIET_MS      2000
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of interrupt samples which an interrupt thread can queue for the main thread.  Must be a
+ * power of two.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_INTERRUPT_QUEUE_SIZE 16
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of interrupt threads, and of expanders serviced by each: the expander wired to
+ * the interrupt line and those cascaded through its GPIOs.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_MAX_INTERRUPT_THREADS 2
+#define SX1509_INTERRUPT_THREAD_MAX_EXPANDERS 3
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of change event handlers which can be registered across all expanders.  The handlers are
+ * allocated from a pool of this size when they are registered, so that nothing is allocated while
+ * events are reported.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_MAX_SUBSCRIBERS 64
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of times the event status is serviced by one call of the interrupt handler.
+ * Events which are still latched after that are cleared and counted as overruns.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_MAX_SERVICE_PASSES 8
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of distinct I2C bus/address pairs for which an open handle is cached.
+ */
+//--------------------------------------------------------------------------------------------------
+#define I2C_HANDLE_CACHE_SIZE 8
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * An open transport handle which is bound to a single device.  For the Linux transport this is a
+ * file descriptor to an I2C bus which has already been bound to a device address with
+ * I2C_SLAVE_FORCE.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    bool inUse;      ///< true if this slot of the cache holds an open handle
+    uint8_t i2cBus;  ///< I2C bus the handle was opened on
+    uint8_t i2cAddr; ///< I2C address the handle is bound to
+    int handle;      ///< The open handle
+} I2cHandle_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Cache of open I2C handles.  Opening the bus device and binding the slave address costs several
+ * system calls, so it is done once per bus/address pair and the handle is reused for every
+ * subsequent register access.
+ */
+//--------------------------------------------------------------------------------------------------
+static I2cHandle_t I2cHandles[I2C_HANDLE_CACHE_SIZE];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of SX1509 devices that the driver keeps state for.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_MAX_DEVICES 4
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of registers covered by the shadow register file.  The shadow is indexed directly by
+ * register address, so this is one more than the highest shadowed register address.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_SHADOW_SIZE (SX1509_REG_T_FALL_15 + 1)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reset values of the shadowed registers as given in the SX1509 datasheet.  Registers which are not
+ * listed reset to 0x00.
+ */
+//--------------------------------------------------------------------------------------------------
+static const uint8_t Sx1509ShadowResetValues[SX1509_SHADOW_SIZE] =
+{
+    [SX1509_REG_DIR_B]            = 0xFF,
+    [SX1509_REG_DIR_A]            = 0xFF,
+    [SX1509_REG_INTERRUPT_MASK_B] = 0xFF,
+    [SX1509_REG_INTERRUPT_MASK_A] = 0xFF,
+    [SX1509_REG_I_ON_0]           = 0xFF,
+    [SX1509_REG_I_ON_1]           = 0xFF,
+    [SX1509_REG_I_ON_2]           = 0xFF,
+    [SX1509_REG_I_ON_3]           = 0xFF,
+    [SX1509_REG_I_ON_4]           = 0xFF,
+    [SX1509_REG_I_ON_5]           = 0xFF,
+    [SX1509_REG_I_ON_6]           = 0xFF,
+    [SX1509_REG_I_ON_7]           = 0xFF,
+    [SX1509_REG_I_ON_8]           = 0xFF,
+    [SX1509_REG_I_ON_9]           = 0xFF,
+    [SX1509_REG_I_ON_10]          = 0xFF,
+    [SX1509_REG_I_ON_11]          = 0xFF,
+    [SX1509_REG_I_ON_12]          = 0xFF,
+    [SX1509_REG_I_ON_13]          = 0xFF,
+    [SX1509_REG_I_ON_14]          = 0xFF,
+    [SX1509_REG_I_ON_15]          = 0xFF,
+};
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * RegTOn of each GPIO, which is the first of the run of LED driver registers of the GPIO.
+ */
+//--------------------------------------------------------------------------------------------------
+static const uint8_t Sx1509LedRegs[16] =
+{
+    SX1509_REG_T_ON_0,  SX1509_REG_T_ON_1,  SX1509_REG_T_ON_2,  SX1509_REG_T_ON_3,
+    SX1509_REG_T_ON_4,  SX1509_REG_T_ON_5,  SX1509_REG_T_ON_6,  SX1509_REG_T_ON_7,
+    SX1509_REG_T_ON_8,  SX1509_REG_T_ON_9,  SX1509_REG_T_ON_10, SX1509_REG_T_ON_11,
+    SX1509_REG_T_ON_12, SX1509_REG_T_ON_13, SX1509_REG_T_ON_14, SX1509_REG_T_ON_15,
+};
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A change event handler registered for a GPIO.  The address is the reference returned by
+ * gpioExpander_AddChangeEventHandler().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_dls_Link_t link;                                     ///< Link in the subscribers of the GPIO
+    gpioExpander_ChangeCallbackFunc_t handlerPtr;           ///< Plain handler or NULL
+    gpioExpander_TimedChangeCallbackFunc_t timedHandlerPtr; ///< Timed handler or NULL
+    void *contextPtr;                                       ///< Passed to the handler
+    gpioExpander_Edge_t edge;                               ///< Change(s) to report
+    uint32_t sampleMs;                                      ///< Polling period requested
+} Sx1509Subscriber_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Driver state for a single SX1509.
+ *
+ * Only this service configures the expander after it has been reset, so the configuration
+ * registers are mirrored in a write-through shadow.  This turns a read-modify-write of a
+ * configuration register into a single bus write and allows writes which would not change the
+ * register to be skipped entirely.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    bool inUse;                           ///< true if this slot has been assigned to a device
+    uint8_t i2cBus;                       ///< I2C bus that the device is on
+    uint8_t i2cAddr;                      ///< I2C address of the device
+    uint32_t shadowValid[(SX1509_SHADOW_SIZE + 31) / 32]; ///< Bit n is set if shadow[n] matches
+                                                          ///  the device
+    uint8_t shadow[SX1509_SHADOW_SIZE];   ///< Last value written to or read from each register
+    bool dataOutValid;                    ///< true if dataOut matches the device
+    uint16_t dataOut;                     ///< Output latch of DATA_B:DATA_A.  Reading DATA returns
+                                          ///  the level of the pins rather than the latch, so the
+                                          ///  latch is tracked separately from the shadow.
+    gpioExpander_InterruptStats_t interruptStats; ///< Cost of servicing interrupts
+    gpioExpander_KeyHandlerFunc_t keyHandlerPtr;  ///< Key press handler or NULL if the keypad
+                                                  ///  engine is off
+    void *keyContextPtr;                          ///< Passed to keyHandlerPtr
+    uint16_t pinHandlerMask;                      ///< Bit n is set if GPIO n has a per GPIO
+                                                  ///  change handler
+    uint8_t pinSense[16];                         ///< Edges requested by the per GPIO change
+                                                  ///  handlers of each GPIO
+    uint16_t portHandlerMask;                     ///< GPIOs reported to portHandlerPtr
+    uint8_t portTrigger;                          ///< Edges reported to portHandlerPtr
+    gpioExpander_PortChangeCallbackFunc_t portHandlerPtr; ///< Port change handler or NULL
+    void *portContextPtr;                         ///< Passed to portHandlerPtr
+    bool interruptBound;                          ///< true if the interrupt output is serviced,
+                                                  ///  see gpioExpander_BindInterrupt()
+    le_timer_Ref_t pollTimer;                     ///< Samples the polled GPIOs.  Created on first
+                                                  ///  use.
+    uint16_t pollMask;                            ///< Bit n is set if GPIO n is polled
+    uint16_t pollRisingMask;                      ///< Polled GPIOs which report becoming active
+    uint16_t pollFallingMask;                     ///< Polled GPIOs which report becoming inactive
+    uint16_t pollValues;                          ///< Value of the GPIOs at the last sample
+    const gpioExpander_HandlerRecord_t *pollRecords[16]; ///< Handlers of the polled GPIOs
+    uint32_t pollSampleMs[16];                    ///< Period requested for each polled GPIO
+    uint32_t pollBaseMs;                          ///< Shortest period requested
+    uint32_t pollPeriodMs;                        ///< Current period
+    uint32_t pollIdleSamples;                     ///< Samples since the last change
+    uint16_t reportedValues;                      ///< Bit n holds the state last reported to the
+                                                  ///  change handler of GPIO n
+    uint16_t reportedMask;                        ///< Bit n is set if bit n of reportedValues is
+                                                  ///  valid
+    uint16_t cascadeMask;                         ///< Bit n is set if the interrupt of another
+                                                  ///  expander is cascaded through GPIO n and
+                                                  ///  serviced by an interrupt thread
+    uint32_t stormLimit;                          ///< Events per second of a GPIO above which it
+                                                  ///  is throttled or 0 if never throttled
+    uint64_t stormWindowStartUs;                  ///< Start of the second stormEvents counts
+    uint32_t stormEvents[16];                     ///< Events of each GPIO in the current second
+    uint16_t stormMask;                           ///< Bit n is set if GPIO n is throttled
+    uint8_t stormSense[16];                       ///< Edge sense of each throttled GPIO, restored
+                                                  ///  when it is handed back to the interrupt
+    uint64_t stormQuietSinceUs[16];               ///< Last change of each throttled GPIO
+} Sx1509State_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * State of each SX1509 that the driver has accessed.
+ */
+//--------------------------------------------------------------------------------------------------
+static Sx1509State_t Sx1509States[SX1509_MAX_DEVICES];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Issues the I2C transfers which service an interrupt.  The main thread uses the cached handles of
+ * the driver.  An interrupt thread uses handles of its own, so that it touches no state which the
+ * main thread owns.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const gpioExpander_Identifier_t *expander;  ///< Expander to access
+    int *handlePtr;          ///< Handle owned by an interrupt thread or NULL to use the cache
+    uint32_t transactions;   ///< Number of I2C transactions issued
+} Sx1509EventReader_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * What was read from an expander to service one interrupt.  The handlers are called from the
+ * sample afterwards, which may be in another thread.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    bool valid;             ///< false if the event status couldn't be read
+    uint8_t numPasses;      ///< Number of entries of status and data
+    uint8_t dataValidMask;  ///< Bit n is set if data[n] was read successfully
+    uint16_t status[SX1509_MAX_SERVICE_PASSES]; ///< Events cleared by each pass
+    uint16_t data[SX1509_MAX_SERVICE_PASSES];   ///< GPIOs read after the events were cleared
+    uint16_t overrunStatus; ///< Events discarded after the last pass
+    uint8_t keyData[2];     ///< KEY_DATA_1 and KEY_DATA_2
+    uint32_t transactions;  ///< Number of I2C transactions issued
+    uint64_t timestampUs;   ///< When the interrupt was raised
+} Sx1509InterruptSample_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * An expander serviced by an interrupt thread.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const gpioExpander_Identifier_t *expander;    ///< The expander
+    const gpioExpander_HandlerRecord_t *handlers; ///< Its 16 handler records
+    Sx1509State_t *state;        ///< Its state.  The interrupt thread only reads keyHandlerPtr.
+    uint8_t parentPin;           ///< GPIO of the first expander its interrupt is cascaded through
+    int handle;                  ///< I2C handle owned by the interrupt thread
+    uint32_t droppedEdges;       ///< Events lost because the queue was full.  Accessed atomically.
+} Sx1509InterruptSource_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A sample queued by an interrupt thread for the main thread.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint8_t source;                  ///< Index of the expander within the interrupt thread
+    Sx1509InterruptSample_t sample;  ///< What was read from the expander
+} Sx1509QueuedSample_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A thread which services the interrupt line of one or more expanders.  The thread only reads and
+ * clears the events.  The samples are passed to the main thread through a single producer, single
+ * consumer ring and the handlers are called there, so that the main thread remains the only user of
+ * the rest of the driver state.
+ */
+//--------------------------------------------------------------------------------------------------
+struct gpioExpander_InterruptThread
+{
+    le_thread_Ref_t thread;                   ///< The thread
+    gpioExpander_InterruptBindFunc_t bindFunc; ///< Registers the handler of the interrupt line
+    void *bindContextPtr;                     ///< Passed to bindFunc
+    Sx1509InterruptSource_t sources[SX1509_INTERRUPT_THREAD_MAX_EXPANDERS]; ///< The expander wired
+                                              ///  to the line first, then the cascaded ones
+    uint8_t numSources;                       ///< Number of entries of sources
+    int eventFd;                              ///< Signalled when samples are queued
+    le_fdMonitor_Ref_t fdMonitor;             ///< Drains the queue in the main thread
+    Sx1509QueuedSample_t queue[SX1509_INTERRUPT_QUEUE_SIZE]; ///< The queued samples
+    uint32_t queueHead;                       ///< Written by the interrupt thread only
+    uint32_t queueTail;                       ///< Written by the main thread only
+};
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The interrupt threads created by gpioExpander_CreateInterruptThread().
+ */
+//--------------------------------------------------------------------------------------------------
+static struct gpioExpander_InterruptThread InterruptThreads[SX1509_MAX_INTERRUPT_THREADS];
+static int NumInterruptThreads;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of I2C transactions that have been issued on any bus.  A retry after reopening a stale
+ * handle counts as a separate transaction.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t I2cTransactionCount;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * I2C bus of the most recent transaction or -1 if there hasn't been one.  On the Green board the
+ * expander buses are channels of one I2C switch, so this is the channel that the switch currently
+ * has selected.
+ */
+//--------------------------------------------------------------------------------------------------
+static int I2cLastBus = -1;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of register writes that can be deferred.  The queue is flushed early if it fills.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SCHED_MAX_PENDING_WRITES 64
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A register write which has been deferred by gpioExpander_DeferWrites().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint8_t i2cBus;                    ///< I2C bus that the device is on
+    uint8_t i2cAddr;                   ///< I2C address of the device
+    gpioExpander_I2cRegWrite_t write;  ///< The register and value to write
+} SchedPendingWrite_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * State of the transaction scheduler.  Writes are queued in the order they were made and are later
+ * issued grouped by bus.  The writes on each bus keep the order in which they were made.
+ */
+//--------------------------------------------------------------------------------------------------
+static SchedPendingWrite_t SchedPendingWrites[SCHED_MAX_PENDING_WRITES];
+static int SchedPendingCount;
+static int SchedDeferDepth;   ///< Nesting depth of gpioExpander_DeferWrites() calls
+static bool SchedFlushing;    ///< true while queued writes are being issued
+static bool SchedFailed;      ///< true if a queued write has failed since the queue was opened
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The shared memory page in which the state of the GPIOs is published, or NULL until
+ * gpioExpander_PublishState() is called.  Port n of the page holds StatePageExpanders[n].
+ */
+//--------------------------------------------------------------------------------------------------
+static gpioExpanderStatePage_t *StatePage;
+static gpioExpander_Identifier_t StatePageExpanders[GPIO_EXPANDER_STATE_PAGE_MAX_PORTS];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A set of register writes to a single SX1509 which is built against the shadow and then issued as
+ * one combined I2C transfer.  Writes which would not change a register are never added.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const gpioExpander_Identifier_t *expander;  ///< Device the writes are for
+    uint8_t count;                              ///< Number of writes in the batch
+    gpioExpander_I2cRegWrite_t writes[GPIO_EXPANDER_MAX_REG_WRITES]; ///< Writes in bus order
+} Sx1509Batch_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The per pin fields of the SX1509 which the driver accesses one pin at a time.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    SX1509_FIELD_DIR,
+    SX1509_FIELD_DATA,
+    SX1509_FIELD_POLARITY,
+    SX1509_FIELD_PULL_UP,
+    SX1509_FIELD_PULL_DOWN,
+    SX1509_FIELD_OPEN_DRAIN,
+    SX1509_FIELD_INTERRUPT_MASK,
+    SX1509_FIELD_SENSE,
+    SX1509_FIELD_DEBOUNCE_ENABLE,
+    SX1509_FIELD_INPUT_DISABLE,
+    SX1509_FIELD_LED_DRIVER_ENABLE,
+    SX1509_FIELD_COUNT
+} Sx1509PinField_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Location of the field of a single pin.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint8_t reg;    ///< Register which contains the field
+    uint8_t shift;  ///< Bit offset of the field within the register
+    uint8_t mask;   ///< Mask of the field within the register, ie. already shifted
+} Sx1509PinFieldAccess_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initializers for the location of the field of a pin.
+ *
+ * The registers are arranged consistently such that the register which contains the field for GPIO
+ * 0 is followed by the one for GPIO 15.  The 1 bit fields of 16 GPIOs span 2 registers and the
+ * 2 bit fields span 4.  Within each register the field of the highest numbered GPIO is in the most
+ * significant bit(s).
+ */
+//--------------------------------------------------------------------------------------------------
+#define SX1509_FIELD_1BIT(baseReg, pin) \
+    { (baseReg) - (pin) / 8, (pin) % 8, 0x1 << ((pin) % 8) }
+#define SX1509_FIELD_2BIT(baseReg, pin) \
+    { (baseReg) - (pin) / 4, 2 * ((pin) % 4), 0x3 << (2 * ((pin) % 4)) }
+#define SX1509_FIELD_ALL_PINS(fieldMacro, baseReg) \
+    { \
+        fieldMacro(baseReg, 0),  fieldMacro(baseReg, 1),  fieldMacro(baseReg, 2), \
+        fieldMacro(baseReg, 3),  fieldMacro(baseReg, 4),  fieldMacro(baseReg, 5), \
+        fieldMacro(baseReg, 6),  fieldMacro(baseReg, 7),  fieldMacro(baseReg, 8), \
+        fieldMacro(baseReg, 9),  fieldMacro(baseReg, 10), fieldMacro(baseReg, 11), \
+        fieldMacro(baseReg, 12), fieldMacro(baseReg, 13), fieldMacro(baseReg, 14), \
+        fieldMacro(baseReg, 15) \
+    }
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Location of every (field, pin) pair.  The table is computed by the compiler so that accessing
+ * the field of a pin is a single lookup.
+ */
+//--------------------------------------------------------------------------------------------------
+static const Sx1509PinFieldAccess_t Sx1509PinFields[SX1509_FIELD_COUNT][16] =
+{
+    [SX1509_FIELD_DIR]            = SX1509_FIELD_ALL_PINS(SX1509_FIELD_1BIT, SX1509_REG_DIR_A),
+    [SX1509_FIELD_DATA]           = SX1509_FIELD_ALL_PINS(SX1509_FIELD_1BIT, SX1509_REG_DATA_A),
+    [SX1509_FIELD_POLARITY]       = SX1509_FIELD_ALL_PINS(SX1509_FIELD_1BIT, SX1509_REG_POLARITY_A),
+    [SX1509_FIELD_PULL_UP]        = SX1509_FIELD_ALL_PINS(SX1509_FIELD_1BIT, SX1509_REG_PULL_UP_A),
+    [SX1509_FIELD_PULL_DOWN]      =
+        SX1509_FIELD_ALL_PINS(SX1509_FIELD_1BIT, SX1509_REG_PULL_DOWN_A),
+    [SX1509_FIELD_OPEN_DRAIN]     =
+        SX1509_FIELD_ALL_PINS(SX1509_FIELD_1BIT, SX1509_REG_OPEN_DRAIN_A),
+    [SX1509_FIELD_INTERRUPT_MASK] =
+        SX1509_FIELD_ALL_PINS(SX1509_FIELD_1BIT, SX1509_REG_INTERRUPT_MASK_A),
+    [SX1509_FIELD_SENSE]          =
+        SX1509_FIELD_ALL_PINS(SX1509_FIELD_2BIT, SX1509_REG_SENSE_LOW_A),
+    [SX1509_FIELD_DEBOUNCE_ENABLE] =
+        SX1509_FIELD_ALL_PINS(SX1509_FIELD_1BIT, SX1509_REG_DEBOUNCE_ENABLE_A),
+    [SX1509_FIELD_INPUT_DISABLE] =
+        SX1509_FIELD_ALL_PINS(SX1509_FIELD_1BIT, SX1509_REG_INPUT_DISABLE_A),
+    [SX1509_FIELD_LED_DRIVER_ENABLE] =
+        SX1509_FIELD_ALL_PINS(SX1509_FIELD_1BIT, SX1509_REG_LED_DRIVER_ENABLE_A),
+};
+
+//-------------------------------------------------------------------------------------------------
+// Static function declarations
+//-------------------------------------------------------------------------------------------------
+
+// Low level linux i2c transport
+static int I2cAccessBusAddr(uint8_t i2cBus, uint8_t i2cAddr);
+static void LinuxI2cClose(int fd);
+static int LinuxI2cReadByteData(int fd, uint8_t reg);
+static int LinuxI2cWriteByteData(int fd, uint8_t reg, uint8_t data);
+static int LinuxI2cReadBlockData(int fd, uint8_t reg, uint8_t length, uint8_t *data);
+static int LinuxI2cWriteBlockData(int fd, uint8_t reg, uint8_t length, const uint8_t *data);
+static int LinuxI2cWriteRegs(
+    int fd, uint8_t i2cAddr, const gpioExpander_I2cRegWrite_t *writes, uint8_t count);
+
+// Wrapper on top of the i2c transport
+static int I2cGetHandle(uint8_t i2cBus, uint8_t i2cAddr);
+static void I2cInvalidateHandle(uint8_t i2cBus, uint8_t i2cAddr);
+static void I2cCloseAllHandles(void);
+static bool I2cIsStaleHandleError(int err);
+static le_result_t SmbusReadReg(uint8_t i2cBus, uint8_t i2cAddr, uint8_t reg, uint8_t *data);
+static le_result_t SmbusWriteReg(uint8_t i2cBus, uint8_t i2cAddr, uint8_t reg, uint8_t data);
+static le_result_t SmbusWriteRegNow(uint8_t i2cBus, uint8_t i2cAddr, uint8_t reg, uint8_t data);
+static le_result_t SmbusReadBlock(
+    uint8_t i2cBus, uint8_t i2cAddr, uint8_t reg, uint8_t length, uint8_t *data);
+static le_result_t SmbusWriteBlock(
+    uint8_t i2cBus, uint8_t i2cAddr, uint8_t reg, uint8_t length, const uint8_t *data);
+static le_result_t I2cWriteRegs(
+    uint8_t i2cBus, uint8_t i2cAddr, const gpioExpander_I2cRegWrite_t *writes, uint8_t count);
+
+// Transaction scheduler
+static bool SchedIsDeferring(void);
+static le_result_t SchedQueueWrites(
+    uint8_t i2cBus, uint8_t i2cAddr, const gpioExpander_I2cRegWrite_t *writes, uint8_t count);
+static le_result_t SchedQueueBlock(
+    uint8_t i2cBus, uint8_t i2cAddr, uint8_t reg, uint8_t length, const uint8_t *data);
+static void SchedFlushBus(uint8_t i2cBus);
+static void SchedFlushAll(void);
+
+// Published GPIO state
+static void StatePageWritePort(
+    gpioExpanderStatePage_Port_t *port, uint16_t value, uint16_t validMask);
+static void StatePageUpdate(
+    const gpioExpander_Identifier_t *expander, uint16_t value, uint16_t mask);
+static void StatePagePublishOutputs(
+    const gpioExpander_Identifier_t *expander, const Sx1509State_t *state, uint16_t mask);
+
+// Low level helper
+static le_result_t SmbusReadModifyWrite(
+    uint8_t i2cBus, uint8_t i2cAddr, uint8_t reg, uint8_t writeData, uint8_t writeMask);
+
+// Shadow register file
+static Sx1509State_t *Sx1509GetState(const gpioExpander_Identifier_t *expander);
+static bool Sx1509IsShadowedReg(uint8_t reg);
+static bool Sx1509IsShadowValid(const Sx1509State_t *state, uint8_t reg);
+static void Sx1509SetShadowValid(Sx1509State_t *state, uint8_t reg, bool valid);
+static void Sx1509ResetShadow(Sx1509State_t *state);
+static le_result_t Sx1509ReadReg(
+    const gpioExpander_Identifier_t *expander, uint8_t reg, uint8_t *data);
+static le_result_t Sx1509UpdateReg(
+    const gpioExpander_Identifier_t *expander, uint8_t reg, uint8_t writeData, uint8_t writeMask);
+static le_result_t Sx1509UpdateData(
+    const gpioExpander_Identifier_t *expander, uint16_t writeData, uint16_t writeMask);
+static le_result_t Sx1509UpdateRegs(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t firstReg,
+    uint8_t count,
+    const uint8_t *writeData,
+    const uint8_t *writeMask);
+static le_result_t Sx1509UpdateRegPair(
+    const gpioExpander_Identifier_t *expander, uint8_t regB, uint16_t writeData, uint16_t writeMask);
+static le_result_t Sx1509LoadDataOut(
+    const gpioExpander_Identifier_t *expander, Sx1509State_t *state);
+static void Sx1509InvalidateReg(uint8_t i2cBus, uint8_t i2cAddr, uint8_t reg);
+
+// Combined register writes
+static void Sx1509BatchInit(Sx1509Batch_t *batch, const gpioExpander_Identifier_t *expander);
+static le_result_t Sx1509BatchAddReg(
+    Sx1509Batch_t *batch, uint8_t reg, uint8_t writeData, uint8_t writeMask);
+static le_result_t Sx1509BatchAddPinField(
+    Sx1509Batch_t *batch, uint8_t pin, Sx1509PinField_t field, uint8_t fieldData);
+static le_result_t Sx1509BatchAddData(Sx1509Batch_t *batch, uint16_t writeData, uint16_t writeMask);
+static le_result_t Sx1509BatchCommit(Sx1509Batch_t *batch);
+
+// Mid-level helpers
+static const Sx1509PinFieldAccess_t *Sx1509GetPinFieldAccess(uint8_t pin, Sx1509PinField_t field);
+
+// High level functions
+static le_result_t Sx1509ReadPinField(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    Sx1509PinField_t field,
+    uint8_t *fieldData);
+static le_result_t Sx1509WritePinField(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    Sx1509PinField_t field,
+    uint8_t fieldData);
+static uint8_t Sx1509GetShadowedPinField(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    Sx1509PinField_t field);
+
+// Helper functions used to implement the public functions
+static le_result_t Sx1509EnableOscillator(const gpioExpander_Identifier_t *expander);
+static le_result_t Sx1509EncodeLedTime(
+    uint32_t timeMs, uint64_t unitUs, uint8_t longScale, uint8_t *setting);
+static le_result_t Sx1509EncodeKeyTime(uint32_t timeMs, uint32_t unitMs, uint8_t *setting);
+static bool Sx1509HasUnmaskedInterrupts(const gpioExpander_Identifier_t *expander);
+static void Sx1509DecodeKey(const uint8_t *keyData, int *row, int *column);
+static le_result_t Sx1509ReaderReadBlock(
+    Sx1509EventReader_t *reader, uint8_t reg, uint8_t length, uint8_t *data);
+static le_result_t Sx1509ReaderWriteBlock(
+    Sx1509EventReader_t *reader, uint8_t reg, uint8_t length, const uint8_t *data);
+static le_result_t Sx1509ReadEventStatus(Sx1509EventReader_t *reader, uint16_t *status);
+static le_result_t Sx1509ClearEventStatus(Sx1509EventReader_t *reader, uint16_t status);
+static void Sx1509CaptureEvents(
+    Sx1509EventReader_t *reader,
+    bool readKeys,
+    bool readStatus,
+    uint64_t timestampUs,
+    Sx1509InterruptSample_t *sample);
+static void Sx1509DispatchSample(
+    const gpioExpander_Identifier_t *expander,
+    Sx1509State_t *state,
+    const gpioExpander_HandlerRecord_t *handlers,
+    const Sx1509InterruptSample_t *sample);
+static void Sx1509DispatchEvents(
+    const gpioExpander_Identifier_t *expander,
+    Sx1509State_t *state,
+    const gpioExpander_HandlerRecord_t *handlers,
+    uint16_t status,
+    uint16_t data,
+    uint64_t timestampUs);
+static void *Sx1509InterruptThreadMain(void *contextPtr);
+static void Sx1509QueueSample(
+    struct gpioExpander_InterruptThread *thread,
+    uint8_t source,
+    const Sx1509InterruptSample_t *sample);
+static void Sx1509InterruptQueueHandler(int fd, short events);
+static void Sx1509ApplySubscribers(
+    const gpioExpander_Identifier_t *expander,
+    Sx1509State_t *state,
+    uint8_t pin,
+    gpioExpander_HandlerRecord_t *handlerRecord);
+static void Sx1509CallChangeHandler(
+    const gpioExpander_HandlerRecord_t *handler,
+    gpioExpander_Edge_t sense,
+    bool active,
+    uint64_t timestampUs);
+static gpioExpander_Edge_t Sx1509GetWatchedSense(const Sx1509State_t *state, uint8_t pin);
+static le_result_t Sx1509ApplyWatch(
+    const gpioExpander_Identifier_t *expander,
+    Sx1509State_t *state,
+    uint8_t pin,
+    Sx1509Batch_t *batch);
+static le_result_t Sx1509ApplyPortWatch(
+    const gpioExpander_Identifier_t *expander, Sx1509State_t *state, uint16_t mask);
+static void Sx1509StartPoll(const gpioExpander_Identifier_t *expander, Sx1509State_t *state);
+static void Sx1509ThrottlePin(
+    const gpioExpander_Identifier_t *expander,
+    Sx1509State_t *state,
+    const gpioExpander_HandlerRecord_t *handlers,
+    uint8_t pin,
+    uint16_t data,
+    uint64_t timestampUs);
+static void Sx1509UnthrottlePin(
+    const gpioExpander_Identifier_t *expander, Sx1509State_t *state, uint8_t pin);
+static void Sx1509StopPoll(Sx1509State_t *state, uint8_t pin);
+static void Sx1509PollTimerHandler(le_timer_Ref_t timer);
+static le_result_t EnableInterrupt(
+    const gpioExpander_Identifier_t *expander, uint8_t pin, bool enable);
+static le_result_t WriteData(const gpioExpander_Identifier_t *expander, uint8_t pin, bool active);
+static le_result_t SetOutput(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    gpioExpander_OutputType_t outputType,
+    gpioExpander_Polarity_t polarity,
+    bool value);
+static le_result_t SetPullType(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    gpioExpander_PullUpDown_t pullType);
+static le_result_t SetPolarity(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    gpioExpander_Polarity_t polarity);
+static le_result_t SetDirection(
+    const gpioExpander_Identifier_t *expander, uint8_t pin, bool isInput);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Transport which accesses the SX1509 through the Linux i2c-dev interface.
+ */
+//--------------------------------------------------------------------------------------------------
+static const gpioExpander_I2cTransport_t LinuxI2cTransport =
+{
+    .name           = "i2c-dev",
+    .open           = I2cAccessBusAddr,
+    .close          = LinuxI2cClose,
+    .readByteData   = LinuxI2cReadByteData,
+    .writeByteData  = LinuxI2cWriteByteData,
+    .readBlockData  = LinuxI2cReadBlockData,
+    .writeBlockData = LinuxI2cWriteBlockData,
+    .writeRegs      = LinuxI2cWriteRegs,
+};
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Transport used for all I2C accesses.
+ */
+//--------------------------------------------------------------------------------------------------
+static const gpioExpander_I2cTransport_t *I2cTransport = &LinuxI2cTransport;
+
+
+//-------------------------------------------------------------------------------------------------
+// Public function definitions
+//-------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the given GPIO as an input with the provided polarity
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_SetInput
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    gpioExpander_Polarity_t polarity
+)
+{
+    if (SetPolarity(expander, pin, polarity) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    if (SetDirection(expander, pin, true) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the given GPIO as a push pull output with the provided polarity
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_SetPushPullOutput
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    gpioExpander_Polarity_t polarity,
+    bool value
+)
+{
+    return SetOutput(expander, pin, GPIO_EXPANDER_OUTPUT_TYPE_PUSH_PULL, polarity, value);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the given GPIO as a tristate output with the provided polarity
+ *
+ * @return
+ *      - LE_NOT_IMPLEMENTED
+ *
+ * @note
+ *      Tristate output type is not currently supported.  It should be possible to implement by
+ *      using the push-pull capability of the hardware for the active and inactive states and
+ *      configuring as an input with neither pull-up nor pull-down resistors for the high-z state.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_SetTriStateOutput
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    gpioExpander_Polarity_t polarity
+)
+{
+    // TODO: implement tristate
+    //return SetOutput(expander, pin, GPIO_EXPANDER_OUTPUT_TYPE_TRISTATE, polarity, value);
+    return LE_NOT_IMPLEMENTED;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the given GPIO as an open drain output with the provided polarity
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_SetOpenDrainOutput
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    gpioExpander_Polarity_t polarity,
+    bool value
+)
+{
+    return SetOutput(expander, pin, GPIO_EXPANDER_OUTPUT_TYPE_OPEN_DRAIN, polarity, value);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Enable a 42 kΩ pull-up resistor on the GPIO
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_EnablePullUp
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    return SetPullType(expander, pin, GPIO_EXPANDER_PULL_UP);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Enable a 42 kΩ pull-down resistor on the GPIO
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_EnablePullDown
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    return SetPullType(expander, pin, GPIO_EXPANDER_PULL_DOWN);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Disable the pull-up and pull-down resistors on the GPIO
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_DisableResistors
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    return SetPullType(expander, pin, GPIO_EXPANDER_PULL_OFF);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Activate the given GPIO
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_Activate
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    return WriteData(expander, pin, true);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deactivate the given GPIO
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_Deactivate
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    return WriteData(expander, pin, false);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the given GPIO to high-Z
+ *
+ * @return
+ *      - LE_NOT_IMPLEMENTED
+ *
+ * @note
+ *      Once this is implemented, it will only be valid for tristate outputs.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_SetHighZ
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    // TODO: implement
+    LE_WARN("SetHighZ API not implemented in GPIO expander service");
+    return LE_NOT_IMPLEMENTED;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads a value for the input GPIO specified
+ *
+ * @return
+ *      - true if the input is active
+ *      - false if the input is inactive
+ */
+//--------------------------------------------------------------------------------------------------
+bool gpioExpander_Read
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    uint8_t readVal;
+    const le_result_t r = Sx1509ReadPinField(
+        expander,
+        pin,
+        SX1509_FIELD_DATA,
+        &readVal);
+
+    if (r != LE_OK)
+    {
+        // TODO: There is no way to give fail a read in le_gpio.api
+        LE_FATAL("Fault while reading GPIO");
+    }
+    StatePageUpdate(expander, readVal << pin, 1 << pin);
+
+    return readVal == 1;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads the input value of all 16 GPIOs of the expander
+ *
+ * DATA_B and DATA_A are fetched in a single auto-incrementing block read, so the value is a
+ * coherent snapshot of the whole expander.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_ReadPort
+(
+    const gpioExpander_Identifier_t *expander,
+    uint16_t *value                        ///< [OUT] Bit n holds the value of GPIO n
+)
+{
+    uint8_t data[2];
+    const le_result_t r = SmbusReadBlock(
+        expander->i2cBus, expander->i2cAddr, SX1509_REG_DATA_B, sizeof(data), data);
+    if (r != LE_OK)
+    {
+        LE_ERROR("Fault while reading GPIO port");
+        return LE_FAULT;
+    }
+
+    *value = ((data[0] << 8) | data[1]);
+    StatePageUpdate(expander, *value, 0xFFFF);
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the output value of several GPIOs of the expander at once
+ *
+ * All of the selected GPIOs are updated by a single I2C write.  When the mask selects GPIOs in both
+ * banks, DATA_B and DATA_A are written back to back within the same transaction.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ *
+ * @note
+ *      No check is performed to ensure that the selected GPIOs are outputs.  The value written to an
+ *      input takes effect once the GPIO is configured as an output.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_WritePort
+(
+    const gpioExpander_Identifier_t *expander,
+    uint16_t mask,                         ///< [IN] Bit n is set if GPIO n is to be written
+    uint16_t value                         ///< [IN] Bit n is set if GPIO n is to be activated or
+                                           ///  cleared if it is to be deactivated
+)
+{
+    if (Sx1509UpdateData(expander, value, mask) != LE_OK)
+    {
+        LE_ERROR("Fault while writing GPIO port");
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Configures any number of GPIOs of the expander at once
+ *
+ * The final value of every configuration register is computed up front so that each register is
+ * written at most once, and not at all if it already holds the required value.  The registers are
+ * written in the following order so that no pin is driven to an unintended level or has both of
+ * its resistors enabled while the configuration is in progress:
+ *
+ *  1. PULL_UP and PULL_DOWN, clearing the resistors which are turned off before setting the new
+ *     ones
+ *  2. OPEN_DRAIN and POLARITY
+ *  3. DATA of the GPIOs which are to be outputs
+ *  4. DIR, so that outputs start driving their initial value
+ *  5. SENSE and finally INTERRUPT_MASK, so that interrupts are only unmasked once fully configured
+ *
+ * The interrupt of a GPIO with an edge is only unmasked if a handler or a cascaded expander watches
+ * it and the GPIO is neither polled nor throttled.  Otherwise it is unmasked when a handler is registered, which
+ * causes no further I2C traffic for the edge sense since it already holds the requested value.
+ * A throttled GPIO takes on the edge once it calms down.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_BAD_PARAMETER if a configuration is invalid.  Nothing is written in this case.
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_ConfigurePins
+(
+    const gpioExpander_Identifier_t *expander,
+    uint16_t mask,                             ///< [IN] Bit n is set if GPIO n is to be configured
+    const gpioExpander_PinConfig_t *configs    ///< [IN] An array of 16 configurations indexed by
+                                               ///  GPIO.  Only the entries selected by mask are
+                                               ///  used.
+)
+{
+    uint16_t outputs = 0;
+    uint16_t openDrain = 0;
+    uint16_t inverted = 0;
+    uint16_t active = 0;
+    uint16_t pullUp = 0;
+    uint16_t pullDown = 0;
+    uint16_t interruptMask = 0;
+    uint32_t sense = 0;
+    uint32_t senseMask = 0;
+
+    if (mask == 0)
+    {
+        return LE_OK;
+    }
+
+    for (uint8_t pin = 0; pin <= 15; pin++)
+    {
+        const uint16_t pinMask = (1 << pin);
+        if ((mask & pinMask) == 0)
+        {
+            continue;
+        }
+
+        const gpioExpander_PinConfig_t *config = &configs[pin];
+        if (config->mode > GPIO_EXPANDER_PIN_MODE_OPEN_DRAIN_OUTPUT ||
+            config->polarity > GPIO_EXPANDER_ACTIVE_LOW ||
+            config->pull > GPIO_EXPANDER_PULL_UP ||
+            config->edge > GPIO_EXPANDER_EDGE_BOTH)
+        {
+            LE_ERROR("Invalid configuration for pin %d", pin);
+            return LE_BAD_PARAMETER;
+        }
+
+        if (config->mode != GPIO_EXPANDER_PIN_MODE_INPUT)
+        {
+            outputs |= pinMask;
+        }
+        if (config->mode == GPIO_EXPANDER_PIN_MODE_OPEN_DRAIN_OUTPUT)
+        {
+            openDrain |= pinMask;
+        }
+        if (config->polarity == GPIO_EXPANDER_ACTIVE_LOW)
+        {
+            inverted |= pinMask;
+        }
+        if (config->value)
+        {
+            active |= pinMask;
+        }
+        if (config->pull == GPIO_EXPANDER_PULL_UP)
+        {
+            pullUp |= pinMask;
+        }
+        else if (config->pull == GPIO_EXPANDER_PULL_DOWN)
+        {
+            pullDown |= pinMask;
+        }
+        if (config->edge == GPIO_EXPANDER_EDGE_NONE)
+        {
+            interruptMask |= pinMask;
+        }
+
+        const uint8_t senseShift = 2 * pin;
+        sense |= ((uint32_t)config->edge << senseShift);
+        senseMask |= ((uint32_t)0x3 << senseShift);
+    }
+
+    // Throttled GPIOs keep their edge sense off and their interrupt masked until they calm down.
+    // Only GPIOs watched by a handler and serviced by the interrupt are unmasked, the rest stay
+    // masked until a handler is registered.
+    Sx1509State_t *state = Sx1509GetState(expander);
+    const uint16_t throttled = mask & state->stormMask;
+    for (uint8_t pin = 0; pin <= 15; pin++)
+    {
+        if ((throttled & (1 << pin)) != 0)
+        {
+            senseMask &= ~((uint32_t)0x3 << (2 * pin));
+        }
+    }
+    const uint16_t unmasked = state->interruptBound ?
+        (mask & ~interruptMask &
+            (state->pinHandlerMask | state->portHandlerMask | state->cascadeMask) &
+            ~state->pollMask & ~state->stormMask) :
+        0;
+    const uint16_t interruptWriteMask = interruptMask | unmasked;
+
+    // Resistors which are turned off are cleared before any are turned on, so that no GPIO moving
+    // from one resistor to the other has both enabled in between
+    le_result_t r = Sx1509UpdateRegPair(expander, SX1509_REG_PULL_UP_B, 0, mask & ~pullUp);
+    if (r == LE_OK)
+    {
+        r = Sx1509UpdateRegPair(expander, SX1509_REG_PULL_DOWN_B, 0, mask & ~pullDown);
+    }
+    if (r == LE_OK)
+    {
+        r = Sx1509UpdateRegPair(expander, SX1509_REG_PULL_UP_B, pullUp, pullUp);
+    }
+    if (r == LE_OK)
+    {
+        r = Sx1509UpdateRegPair(expander, SX1509_REG_PULL_DOWN_B, pullDown, pullDown);
+    }
+    if (r == LE_OK)
+    {
+        r = Sx1509UpdateRegPair(expander, SX1509_REG_OPEN_DRAIN_B, openDrain, mask);
+    }
+    if (r == LE_OK)
+    {
+        r = Sx1509UpdateRegPair(expander, SX1509_REG_POLARITY_B, inverted, mask);
+    }
+    if (r == LE_OK)
+    {
+        // The latch of GPIOs which are to be inputs is left alone so that an output which is
+        // about to become an input doesn't change level before it is released.
+        r = Sx1509UpdateData(expander, active, outputs);
+    }
+    if (r == LE_OK)
+    {
+        // A set bit in DIR makes the GPIO an input
+        r = Sx1509UpdateRegPair(expander, SX1509_REG_DIR_B, ~outputs, mask);
+    }
+    if (r == LE_OK)
+    {
+        // SENSE_HIGH_B holds the fields of GPIOs 15-12 and SENSE_LOW_A those of GPIOs 3-0
+        const uint8_t senseData[] = { sense >> 24, sense >> 16, sense >> 8, sense };
+        const uint8_t senseWriteMask[] =
+            { senseMask >> 24, senseMask >> 16, senseMask >> 8, senseMask };
+        r = Sx1509UpdateRegs(
+            expander, SX1509_REG_SENSE_HIGH_B, sizeof(senseData), senseData, senseWriteMask);
+    }
+    if (r == LE_OK)
+    {
+        r = Sx1509UpdateRegPair(
+            expander, SX1509_REG_INTERRUPT_MASK_B, interruptMask, interruptWriteMask);
+    }
+
+    if (r != LE_OK)
+    {
+        LE_ERROR(
+            "Failed to configure pins 0x%04x of GPIO expander on I2C bus %d at address 0x%x",
+            mask,
+            expander->i2cBus,
+            expander->i2cAddr);
+        return LE_FAULT;
+    }
+
+    for (uint8_t pin = 0; pin <= 15; pin++)
+    {
+        if ((throttled & (1 << pin)) != 0)
+        {
+            state->stormSense[pin] = configs[pin].edge;
+        }
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The pool from which change event handlers are allocated.  Created on first use, as handlers are
+ * registered from COMPONENT_INIT of the board configuration.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t SubscriberPool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Registers a plain or timed handler for an edge transition of a GPIO.  Exactly one of the handler
+ * pointers is non-NULL.
+ *
+ * @return
+ *      The reference or NULL if the pool of handlers is exhausted
+ */
+//--------------------------------------------------------------------------------------------------
+static gpioExpander_ChangeCallbackRef_t AddChangeEventHandler
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    gpioExpander_HandlerRecord_t *handlerRecord,
+    gpioExpander_Edge_t edge,
+    gpioExpander_ChangeCallbackFunc_t handlerPtr,
+    gpioExpander_TimedChangeCallbackFunc_t timedHandlerPtr,
+    void* contextPtr,
+    int32_t sampleMs
+)
+{
+    if (SubscriberPool == NULL)
+    {
+        SubscriberPool = le_mem_CreatePool("gpioExpanderSubscribers", sizeof(Sx1509Subscriber_t));
+        le_mem_ExpandPool(SubscriberPool, SX1509_MAX_SUBSCRIBERS);
+    }
+
+    Sx1509Subscriber_t *subscriber = le_mem_TryAlloc(SubscriberPool);
+    if (subscriber == NULL)
+    {
+        LE_ERROR(
+            "No room for another handler for GPIO expander on I2C bus %d at address 0x%x for pin "
+            "%d",
+            expander->i2cBus,
+            expander->i2cAddr,
+            pin);
+        return NULL;
+    }
+    subscriber->handlerPtr = handlerPtr;
+    subscriber->timedHandlerPtr = timedHandlerPtr;
+    subscriber->contextPtr = contextPtr;
+    subscriber->edge = edge;
+    subscriber->sampleMs = (sampleMs > 0) ? sampleMs : SX1509_POLL_DEFAULT_MS;
+
+    // The first handler starts from an unknown reported state
+    Sx1509State_t *state = Sx1509GetState(expander);
+    if (le_dls_IsEmpty(&handlerRecord->subscribers))
+    {
+        state->reportedMask &= ~(1 << pin);
+    }
+    le_dls_Queue(&handlerRecord->subscribers, &subscriber->link);
+    state->pinHandlerMask |= (1 << pin);
+    Sx1509ApplySubscribers(expander, state, pin, handlerRecord);
+
+    return (gpioExpander_ChangeCallbackRef_t)subscriber;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Register the given handler for an edge transition of a GPIO configured as an input
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ *
+ * @note
+ *      - The sampleMs parameter is only used if no interrupt is bound to the expander, in which
+ *        case the GPIO is polled.  See gpioExpander_BindInterrupt().
+ *      - Any number of handlers may be registered for each GPIO, up to SX1509_MAX_SUBSCRIBERS in
+ *        total.  The expander senses the edges requested by any of them and each handler is
+ *        called for the edges it requested.
+ */
+//--------------------------------------------------------------------------------------------------
+gpioExpander_ChangeCallbackRef_t gpioExpander_AddChangeEventHandler
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    gpioExpander_HandlerRecord_t *handlerRecord,
+    gpioExpander_Edge_t edge,
+    gpioExpander_ChangeCallbackFunc_t handlerPtr,
+    void* contextPtr,
+    int32_t sampleMs
+)
+{
+    return AddChangeEventHandler(
+        expander, pin, handlerRecord, edge, handlerPtr, NULL, contextPtr, sampleMs);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Register the given handler, which also receives the time of the interrupt, for an edge
+ * transition of a GPIO configured as an input
+ *
+ * @note
+ *      - The sampleMs parameter is used as by gpioExpander_AddChangeEventHandler()
+ *      - Plain and timed handlers may be registered for the same GPIO
+ */
+//--------------------------------------------------------------------------------------------------
+gpioExpander_ChangeCallbackRef_t gpioExpander_AddTimedChangeEventHandler
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    gpioExpander_HandlerRecord_t *handlerRecord,
+    gpioExpander_Edge_t edge,
+    gpioExpander_TimedChangeCallbackFunc_t handlerPtr,
+    void* contextPtr,
+    int32_t sampleMs
+)
+{
+    return AddChangeEventHandler(
+        expander, pin, handlerRecord, edge, NULL, handlerPtr, contextPtr, sampleMs);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deregisters an event handler for changes in the specified pin.  Once the last handler is gone,
+ * the GPIO is left with the edges of the port handler, if it watches it, or stops sensing edges
+ * altogether, see Sx1509ApplyWatch().  An event captured before then is dropped and counted in
+ * unhandledEvents.
+ *
+ * The calling client will be killed if the provided ref parameter is not a reference that was
+ * returned by gpioExpander_AddChangeEventHandler() for the pin.
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioExpander_RemoveChangeEventHandler
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    gpioExpander_HandlerRecord_t *handlerRecord,
+    gpioExpander_ChangeCallbackRef_t ref
+)
+{
+    // Sanity check to make sure that the client held the reference and called with the correct
+    // one.
+    Sx1509Subscriber_t *subscriber = (Sx1509Subscriber_t *)ref;
+    if (subscriber == NULL || !le_dls_IsInList(&handlerRecord->subscribers, &subscriber->link))
+    {
+        LE_KILL_CLIENT("Invalid handler reference");
+        return;
+    }
+    le_dls_Remove(&handlerRecord->subscribers, &subscriber->link);
+    le_mem_Release(subscriber);
+
+    // The remaining handlers may need fewer edges
+    Sx1509State_t *state = Sx1509GetState(expander);
+    if (!le_dls_IsEmpty(&handlerRecord->subscribers))
+    {
+        Sx1509ApplySubscribers(expander, state, pin, handlerRecord);
+        return;
+    }
+
+    // The GPIO keeps the edges of the port handler if it watches it
+    state->pinHandlerMask &= ~(1 << pin);
+    state->pinSense[pin] = GPIO_EXPANDER_EDGE_NONE;
+    state->pollRecords[pin] = NULL;
+
+    // TODO: As above, need a better way to signal failure to the user
+    Sx1509Batch_t batch;
+    Sx1509BatchInit(&batch, expander);
+    LE_FATAL_IF(
+        Sx1509ApplyWatch(expander, state, pin, &batch) != LE_OK ||
+            Sx1509BatchCommit(&batch) != LE_OK,
+        "Failed to disable interrupt during event handler deregistration");
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Registers a handler which is called once per interrupt for any number of GPIOs.  The GPIOs sense
+ * the trigger on top of the edges of their per GPIO handlers, and are polled instead if the
+ * expander has no bound interrupt.  The edge sense and interrupt mask of all of the GPIOs are
+ * written as one combined transfer.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_BAD_PARAMETER
+ *      - LE_DUPLICATE
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_AddPortChangeHandler
+(
+    const gpioExpander_Identifier_t *expander,
+    uint16_t mask,
+    gpioExpander_Edge_t trigger,
+    gpioExpander_PortChangeCallbackFunc_t handlerPtr,
+    void *contextPtr
+)
+{
+    if (mask == 0 || trigger == GPIO_EXPANDER_EDGE_NONE || trigger > GPIO_EXPANDER_EDGE_BOTH ||
+        handlerPtr == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    Sx1509State_t *state = Sx1509GetState(expander);
+    if (state->portHandlerPtr != NULL)
+    {
+        return LE_DUPLICATE;
+    }
+
+    // The handler must be in place before an interrupt can be raised
+    state->portHandlerMask = mask;
+    state->portTrigger = trigger;
+    state->portHandlerPtr = handlerPtr;
+    state->portContextPtr = contextPtr;
+    if (Sx1509ApplyPortWatch(expander, state, mask) != LE_OK)
+    {
+        LE_ERROR("Could not enable interrupts for port handler");
+        state->portHandlerMask = 0;
+        state->portTrigger = GPIO_EXPANDER_EDGE_NONE;
+        state->portHandlerPtr = NULL;
+        state->portContextPtr = NULL;
+        Sx1509ApplyPortWatch(expander, state, mask);
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deregisters the port handler.  The GPIOs which it watched are left with the edges of their per
+ * GPIO handlers, if any.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_RemovePortChangeHandler
+(
+    const gpioExpander_Identifier_t *expander
+)
+{
+    Sx1509State_t *state = Sx1509GetState(expander);
+    const uint16_t mask = state->portHandlerMask;
+    state->portHandlerMask = 0;
+    state->portTrigger = GPIO_EXPANDER_EDGE_NONE;
+    state->portHandlerPtr = NULL;
+    state->portContextPtr = NULL;
+    if (Sx1509ApplyPortWatch(expander, state, mask) != LE_OK)
+    {
+        LE_ERROR("Could not disable interrupts of port handler");
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the edge sensitivity of an input
+ *
+ * The edge sensitivity of an input is also set when the change event handler is registered, so
+ * this function is only useful for changing the edge sensitivity of an input pin with a handler
+ * already registered.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_SetEdgeSense
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    gpioExpander_Edge_t trigger ///< Change(s) that should trigger the callback to be called.
+)
+{
+    le_result_t r = Sx1509WritePinField(
+        expander,
+        pin,
+        SX1509_FIELD_SENSE,
+        trigger);
+    if (r != LE_OK)
+    {
+        LE_ERROR("Could not set edge sense");
+        return LE_FAULT;
+    }
+
+    // The state reported for the new edge(s) is learnt again from the next event
+    Sx1509GetState(expander)->reportedMask &= ~(1 << pin);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the current edge sensitivity setting of a GPIO
+ *
+ * @return
+ *      - The edge sensitivity of the GPIO
+ *
+ * @note
+ *      There is no check performed to ensure that a handler has been registered nor is there a
+ *      check to verify that the specified GPIO is an input.
+ *
+ * @note
+ *      The setting is served from the shadow register file without accessing the I2C bus.
+ */
+//--------------------------------------------------------------------------------------------------
+gpioExpander_Edge_t gpioExpander_GetEdgeSense
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    return Sx1509GetShadowedPinField(expander, pin, SX1509_FIELD_SENSE);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Disables edge sensing for the given GPIO
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_DisableEdgeSense
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    return gpioExpander_SetEdgeSense(expander, pin, GPIO_EXPANDER_EDGE_NONE);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the debounce time of all GPIOs of the expander which have debouncing enabled.  The time is
+ * rounded up to the next time supported by the expander, which are 0.5 ms, 1 ms, 2 ms and so on
+ * up to 64 ms.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_OUT_OF_RANGE if the time is longer than 64 ms
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_SetDebounceTime
+(
+    const gpioExpander_Identifier_t *expander,
+    uint32_t timeUs
+)
+{
+    uint8_t setting = 0;
+    while ((SX1509_DEBOUNCE_TIME_MIN_US << setting) < timeUs)
+    {
+        if (setting == SX1509_DEBOUNCE_TIME_MAX_SETTING)
+        {
+            return LE_OUT_OF_RANGE;
+        }
+        setting++;
+    }
+
+    if (Sx1509EnableOscillator(expander) != LE_OK ||
+        Sx1509UpdateReg(
+            expander, SX1509_REG_DEBOUNCE_CONFIG, setting, SX1509_DEBOUNCE_TIME_MASK) != LE_OK)
+    {
+        LE_ERROR("Could not set debounce time");
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Enables or disables debouncing of an input GPIO.  While enabled, a change of the input is only
+ * seen, and so only raises an interrupt, once the input has been stable for the debounce time.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_SetDebounce
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    bool enable
+)
+{
+    if ((enable && Sx1509EnableOscillator(expander) != LE_OK) ||
+        Sx1509WritePinField(expander, pin, SX1509_FIELD_DEBOUNCE_ENABLE, enable) != LE_OK)
+    {
+        LE_ERROR("Could not %s debouncing", enable ? "enable" : "disable");
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether debouncing is enabled for a GPIO
+ *
+ * @return
+ *      true if debouncing is enabled
+ *
+ * @note
+ *      The setting is served from the shadow register file without accessing the I2C bus.
+ */
+//--------------------------------------------------------------------------------------------------
+bool gpioExpander_IsDebounced
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    return Sx1509GetShadowedPinField(expander, pin, SX1509_FIELD_DEBOUNCE_ENABLE) == 1;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Drives a GPIO from the LED driver of the expander.  The GPIO is made an open-drain output which
+ * sinks the LED current, and then glows, blinks or breathes without any further bus traffic.
+ *
+ * The driver is configured in the order given by the SX1509 datasheet: input buffer, pull-up,
+ * open drain and direction of the GPIO, then the oscillator, the LED clock in RegMisc and the
+ * enable of the driver as one combined transfer, then the timing registers as one block write,
+ * and finally the output latch which starts the driver.
+ * Registers which already hold the requested value are not written, so applying the same
+ * configuration again costs nothing.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_BAD_PARAMETER if breathing is requested on a GPIO which can't breathe or the
+ *        configuration is inconsistent
+ *      - LE_OUT_OF_RANGE if a time can't be produced or the off intensity is too large
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_SetLed
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    const gpioExpander_LedConfig_t *config
+)
+{
+    LE_ASSERT(pin < NUM_ARRAY_MEMBERS(Sx1509LedRegs));
+    const bool breathing = (config->riseTimeMs != 0 || config->fallTimeMs != 0);
+    if ((breathing && !SX1509_LED_CAN_BREATHE(pin)) ||
+        (config->onTimeMs != 0 && config->offTimeMs == 0))
+    {
+        return LE_BAD_PARAMETER;
+    }
+    if (config->offIntensity > SX1509_LED_OFF_INTENSITY_MAX)
+    {
+        return LE_OUT_OF_RANGE;
+    }
+
+    // The rise and fall times scale with the number of intensity steps between off and on
+    const uint8_t offIntensity = config->offIntensity / SX1509_LED_OFF_INTENSITY_STEP;
+    const int fadeSteps = config->onIntensity - (offIntensity * SX1509_LED_OFF_INTENSITY_STEP);
+    if (breathing && fadeSteps <= 0)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    uint8_t regs[SX1509_LED_NUM_REGS_BREATHING] = { 0 };
+    uint8_t offTime;
+    if (Sx1509EncodeLedTime(
+            config->onTimeMs,
+            SX1509_LED_TIME_UNIT_US,
+            SX1509_LED_TIME_LONG_SCALE,
+            &regs[SX1509_LED_REG_T_ON]) != LE_OK ||
+        Sx1509EncodeLedTime(
+            (config->onTimeMs != 0) ? config->offTimeMs : 0,
+            SX1509_LED_TIME_UNIT_US,
+            SX1509_LED_TIME_LONG_SCALE,
+            &offTime) != LE_OK ||
+        (breathing &&
+         (Sx1509EncodeLedTime(
+              config->riseTimeMs,
+              fadeSteps * SX1509_LED_FADE_STEP_US,
+              SX1509_LED_FADE_LONG_SCALE,
+              &regs[SX1509_LED_REG_T_RISE]) != LE_OK ||
+          Sx1509EncodeLedTime(
+              config->fallTimeMs,
+              fadeSteps * SX1509_LED_FADE_STEP_US,
+              SX1509_LED_FADE_LONG_SCALE,
+              &regs[SX1509_LED_REG_T_FALL]) != LE_OK)))
+    {
+        return LE_OUT_OF_RANGE;
+    }
+    regs[SX1509_LED_REG_I_ON] = config->onIntensity;
+    regs[SX1509_LED_REG_OFF] = (offTime << SX1509_LED_OFF_TIME_SHIFT) | offIntensity;
+
+    Sx1509Batch_t batch;
+    Sx1509BatchInit(&batch, expander);
+    if (Sx1509BatchAddPinField(&batch, pin, SX1509_FIELD_INPUT_DISABLE, 1) != LE_OK ||
+        Sx1509BatchAddPinField(&batch, pin, SX1509_FIELD_PULL_UP, 0) != LE_OK ||
+        Sx1509BatchAddPinField(&batch, pin, SX1509_FIELD_PULL_DOWN, 0) != LE_OK ||
+        Sx1509BatchAddPinField(&batch, pin, SX1509_FIELD_OPEN_DRAIN, 1) != LE_OK ||
+        Sx1509BatchAddPinField(&batch, pin, SX1509_FIELD_DIR, SX1509_DIRECTION_OUTPUT) != LE_OK ||
+        Sx1509BatchAddReg(
+            &batch,
+            SX1509_REG_CLOCK,
+            SX1509_CLOCK_OSC_SOURCE_INTERNAL,
+            SX1509_CLOCK_OSC_SOURCE_MASK) != LE_OK ||
+        Sx1509BatchAddReg(
+            &batch,
+            SX1509_REG_MISC,
+            SX1509_MISC_LED_CLOCK_DIV8,
+            SX1509_MISC_LED_CLOCK_MASK) != LE_OK ||
+        Sx1509BatchAddPinField(&batch, pin, SX1509_FIELD_LED_DRIVER_ENABLE, 1) != LE_OK ||
+        Sx1509BatchCommit(&batch) != LE_OK)
+    {
+        LE_ERROR("Could not enable the LED driver");
+        return LE_FAULT;
+    }
+
+    static const uint8_t regMasks[SX1509_LED_NUM_REGS_BREATHING] =
+    {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+    };
+    const uint8_t numRegs =
+        SX1509_LED_CAN_BREATHE(pin) ? SX1509_LED_NUM_REGS_BREATHING : SX1509_LED_NUM_REGS;
+
+    // Clearing the output latch starts the LED driver
+    if (Sx1509UpdateRegs(expander, Sx1509LedRegs[pin], numRegs, regs, regMasks) != LE_OK ||
+        Sx1509UpdateData(expander, 0, 1 << pin) != LE_OK)
+    {
+        LE_ERROR("Could not configure the LED driver");
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hands GPIOs of the expander to the keypad engine.  The GPIOs are configured with one combined
+ * transfer and the engine with another, which starts it.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_BAD_PARAMETER
+ *      - LE_OUT_OF_RANGE
+ *      - LE_BUSY
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_EnableKeypad
+(
+    const gpioExpander_Identifier_t *expander,
+    const gpioExpander_KeypadConfig_t *config,
+    gpioExpander_KeyHandlerFunc_t handlerPtr,
+    void *contextPtr
+)
+{
+    if (config->rows < SX1509_KEY_MIN_ROWS || config->rows > SX1509_KEY_MAX_LINES ||
+        config->columns < 1 || config->columns > SX1509_KEY_MAX_LINES || handlerPtr == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    uint8_t scanTime;
+    uint8_t sleepTime = 0;
+    if (Sx1509EncodeKeyTime(config->scanTimeMs, SX1509_KEY_SCAN_TIME_MIN_MS, &scanTime) != LE_OK ||
+        (config->sleepTimeMs != 0 &&
+         Sx1509EncodeKeyTime(config->sleepTimeMs, SX1509_KEY_SLEEP_TIME_UNIT_MS, &sleepTime) !=
+            LE_OK))
+    {
+        return LE_OUT_OF_RANGE;
+    }
+    if (config->sleepTimeMs != 0 && sleepTime == 0)
+    {
+        // Setting 0 would turn sleeping off
+        sleepTime = 1;
+    }
+
+    // Rows are in bank A and columns in bank B.  None of them may be watched by a handler, cascade
+    // an interrupt or drive an LED.
+    const uint8_t rowMask = (1 << config->rows) - 1;
+    const uint8_t columnMask = (1 << config->columns) - 1;
+    const uint16_t keypadMask = ((uint16_t)columnMask << 8) | rowMask;
+    Sx1509State_t *state = Sx1509GetState(expander);
+    uint16_t busy = keypadMask &
+        (state->pinHandlerMask | state->portHandlerMask | state->cascadeMask);
+    for (uint8_t pin = 0; pin < 16; pin++)
+    {
+        if ((keypadMask & (1 << pin)) != 0 &&
+            Sx1509GetShadowedPinField(expander, pin, SX1509_FIELD_LED_DRIVER_ENABLE) != 0)
+        {
+            busy |= (1 << pin);
+        }
+    }
+    if (busy != 0)
+    {
+        LE_ERROR("GPIOs 0x%04x are already in use and can't be part of the keypad", busy);
+        return LE_BUSY;
+    }
+
+    // The handler is in place before the engine starts, so that the first key press is read.  It is
+    // removed again if the engine can't be started.
+    __atomic_store_n(&state->keyHandlerPtr, handlerPtr, __ATOMIC_RELEASE);
+    state->keyContextPtr = contextPtr;
+
+    Sx1509Batch_t batch;
+    Sx1509BatchInit(&batch, expander);
+    if (Sx1509BatchAddReg(
+            &batch,
+            SX1509_REG_CLOCK,
+            SX1509_CLOCK_OSC_SOURCE_INTERNAL,
+            SX1509_CLOCK_OSC_SOURCE_MASK) != LE_OK ||
+        Sx1509BatchAddReg(&batch, SX1509_REG_DIR_A, 0x00, rowMask) != LE_OK ||
+        Sx1509BatchAddReg(&batch, SX1509_REG_OPEN_DRAIN_A, 0xFF, rowMask) != LE_OK ||
+        Sx1509BatchAddReg(&batch, SX1509_REG_DIR_B, 0xFF, columnMask) != LE_OK ||
+        Sx1509BatchAddReg(&batch, SX1509_REG_PULL_DOWN_B, 0x00, columnMask) != LE_OK ||
+        Sx1509BatchAddReg(&batch, SX1509_REG_PULL_UP_B, 0xFF, columnMask) != LE_OK ||
+        Sx1509BatchAddReg(&batch, SX1509_REG_DEBOUNCE_ENABLE_B, 0xFF, columnMask) != LE_OK ||
+        Sx1509BatchCommit(&batch) != LE_OK)
+    {
+        LE_ERROR("Could not configure the keypad GPIOs");
+        __atomic_store_n(&state->keyHandlerPtr, NULL, __ATOMIC_RELEASE);
+        state->keyContextPtr = NULL;
+        return LE_FAULT;
+    }
+
+    // The debounce time, 0.5 ms * 2^n, must be shorter than the scan time, 1 ms * 2^n
+    Sx1509BatchInit(&batch, expander);
+    if (Sx1509BatchAddReg(
+            &batch, SX1509_REG_DEBOUNCE_CONFIG, scanTime, SX1509_DEBOUNCE_TIME_MASK) != LE_OK ||
+        Sx1509BatchAddReg(
+            &batch,
+            SX1509_REG_KEY_CONFIG_1,
+            (sleepTime << SX1509_KEY_SLEEP_TIME_SHIFT) | scanTime,
+            SX1509_KEY_SLEEP_TIME_MASK | SX1509_KEY_SCAN_TIME_MASK) != LE_OK ||
+        Sx1509BatchAddReg(
+            &batch,
+            SX1509_REG_KEY_CONFIG_2,
+            ((config->rows - 1) << SX1509_KEY_ROWS_SHIFT) | (config->columns - 1),
+            SX1509_KEY_ROWS_MASK | SX1509_KEY_COLUMNS_MASK) != LE_OK ||
+        Sx1509BatchCommit(&batch) != LE_OK)
+    {
+        // The engine may have been started by part of the transfer
+        LE_ERROR("Could not start the keypad engine");
+        __atomic_store_n(&state->keyHandlerPtr, NULL, __ATOMIC_RELEASE);
+        state->keyContextPtr = NULL;
+        if (Sx1509UpdateReg(expander, SX1509_REG_KEY_CONFIG_2, 0x00, SX1509_KEY_ROWS_MASK) != LE_OK)
+        {
+            LE_ERROR(
+                "The keypad engine of GPIO expander on I2C bus %d at address 0x%x may still be "
+                "running",
+                expander->i2cBus,
+                expander->i2cAddr);
+        }
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stops the keypad engine
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_DisableKeypad
+(
+    const gpioExpander_Identifier_t *expander
+)
+{
+    Sx1509State_t *state = Sx1509GetState(expander);
+    __atomic_store_n(&state->keyHandlerPtr, NULL, __ATOMIC_RELEASE);
+    state->keyContextPtr = NULL;
+
+    if (Sx1509UpdateReg(expander, SX1509_REG_KEY_CONFIG_2, 0x00, SX1509_KEY_ROWS_MASK) != LE_OK)
+    {
+        LE_ERROR("Could not stop the keypad engine");
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stops driving a GPIO from the LED driver.  The GPIO is left as an open-drain output at high
+ * impedance, so the LED is off, and its input buffer is enabled again.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_DisableLed
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    Sx1509Batch_t batch;
+    Sx1509BatchInit(&batch, expander);
+    if (Sx1509BatchAddPinField(&batch, pin, SX1509_FIELD_LED_DRIVER_ENABLE, 0) != LE_OK ||
+        Sx1509BatchAddData(&batch, 1 << pin, 1 << pin) != LE_OK ||
+        Sx1509BatchAddPinField(&batch, pin, SX1509_FIELD_INPUT_DISABLE, 0) != LE_OK ||
+        Sx1509BatchCommit(&batch) != LE_OK)
+    {
+        LE_ERROR("Could not disable the LED driver");
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks if the given GPIO is an output
+ *
+ * @return
+ *      true if the specified GPIO is an output or false otherwise
+ *
+ * @note
+ *      The setting is served from the shadow register file without accessing the I2C bus.
+ */
+//--------------------------------------------------------------------------------------------------
+bool gpioExpander_IsOutput
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    const Sx1509_Direction_t direction =
+        Sx1509GetShadowedPinField(expander, pin, SX1509_FIELD_DIR);
+
+    return direction == SX1509_DIRECTION_OUTPUT;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks if the given GPIO is an input
+ *
+ * @return
+ *      true if the specified GPIO is an input or false otherwise
+ */
+//--------------------------------------------------------------------------------------------------
+bool gpioExpander_IsInput
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    return !gpioExpander_IsOutput(expander, pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the polarity setting of the given GPIO
+ *
+ * @return
+ *      The polarity of the specified GPIO
+ *
+ * @note
+ *      The setting is served from the shadow register file without accessing the I2C bus.
+ */
+//--------------------------------------------------------------------------------------------------
+gpioExpander_Polarity_t gpioExpander_GetPolarity
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    const Sx1509_Polarity_t polarity =
+        Sx1509GetShadowedPinField(expander, pin, SX1509_FIELD_POLARITY);
+
+    return (polarity == SX1509_POLARITY_NORMAL) ?
+        GPIO_EXPANDER_ACTIVE_HIGH :
+        GPIO_EXPANDER_ACTIVE_LOW;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks if the given GPIO is active or inactive
+ *
+ * @return
+ *      true if the given GPIO is active or false otherwise
+ *
+ * @note
+ *      No check is performed to ensure that the GPIO is an output
+ */
+//--------------------------------------------------------------------------------------------------
+bool gpioExpander_IsActive
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    return gpioExpander_Read(expander, pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the resistor settings of the given GPIO
+ *
+ * @return
+ *      The resistor settings of the given GPIO
+ *
+ * @note
+ *      The setting is served from the shadow register file without accessing the I2C bus.
+ */
+//--------------------------------------------------------------------------------------------------
+gpioExpander_PullUpDown_t gpioExpander_GetPullUpDown
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+)
+{
+    const uint8_t pullUpEnabled =
+        Sx1509GetShadowedPinField(expander, pin, SX1509_FIELD_PULL_UP);
+    const uint8_t pullDownEnabled =
+        Sx1509GetShadowedPinField(expander, pin, SX1509_FIELD_PULL_DOWN);
+
+    if (pullUpEnabled == 0 && pullDownEnabled == 0)
+    {
+        return GPIO_EXPANDER_PULL_OFF;
+    }
+    else if (pullUpEnabled == 1 && pullDownEnabled == 0)
+    {
+        return GPIO_EXPANDER_PULL_UP;
+    }
+    else if (pullUpEnabled == 0 && pullDownEnabled == 1)
+    {
+        return GPIO_EXPANDER_PULL_DOWN;
+    }
+    else
+    {
+        // TODO: There is no way to signal failure using le_gpio.api
+        LE_FATAL("Pullup and pulldown are enabled simultaneously");
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs a software reset of the specified SX1509 GPIO expander
+ *
+ * Upon completion, the SX1509 will be in a state equivalent to if the POR pin had been asserted.
+ * The reset is issued immediately even while writes are deferred.
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioExpander_Reset
+(
+    const gpioExpander_Identifier_t *expander  ///< I2C identifier for the GPIO expander
+)
+{
+    // The reset is never deferred, so that its failure is caught here.  Writes queued for the bus
+    // before it are issued first to keep them in order.
+    SchedFlushBus(expander->i2cBus);
+    const uint8_t magicResetVals[] = { 0x12, 0x34 };
+    for (int i = 0; i < NUM_ARRAY_MEMBERS(magicResetVals); i++)
+    {
+        LE_FATAL_IF(
+            SmbusWriteRegNow(
+                expander->i2cBus, expander->i2cAddr, SX1509_REG_RESET, magicResetVals[i]) != LE_OK,
+            "Failed to reset GPIO expander on I2C bus %d at address 0x%x",
+            expander->i2cBus,
+            expander->i2cAddr);
+    }
+
+    Sx1509State_t *state = Sx1509GetState(expander);
+    Sx1509ResetShadow(state);
+    LE_FATAL_IF(
+        Sx1509UpdateReg(
+            expander, SX1509_REG_MISC, SX1509_MISC_NO_AUTOCLEAR, SX1509_MISC_NO_AUTOCLEAR) != LE_OK,
+        "Failed to configure GPIO expander on I2C bus %d at address 0x%x",
+        expander->i2cBus,
+        expander->i2cAddr);
+    __atomic_store_n(&state->keyHandlerPtr, NULL, __ATOMIC_RELEASE);
+    state->keyContextPtr = NULL;
+    state->portHandlerMask = 0;
+    state->portTrigger = GPIO_EXPANDER_EDGE_NONE;
+    state->portHandlerPtr = NULL;
+    state->portContextPtr = NULL;
+    memset(state->pinSense, 0, sizeof(state->pinSense));
+    state->reportedMask = 0;
+    state->stormMask = 0;
+    memset(state->stormEvents, 0, sizeof(state->stormEvents));
+    for (uint8_t pin = 0; pin < 16; pin++)
+    {
+        if ((state->pollMask & (1 << pin)) != 0)
+        {
+            Sx1509StopPoll(state, pin);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Declares that the interrupt output of the expander is serviced by the caller
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioExpander_BindInterrupt
+(
+    const gpioExpander_Identifier_t *expander
+)
+{
+    Sx1509State_t *state = Sx1509GetState(expander);
+    LE_FATAL_IF(
+        state->pollMask != 0,
+        "Interrupt of GPIO expander on I2C bus %d at address 0x%x bound after polling started",
+        expander->i2cBus,
+        expander->i2cAddr);
+    state->interruptBound = true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets CLOCK_MONOTONIC in microseconds
+ */
+//--------------------------------------------------------------------------------------------------
+uint64_t gpioExpander_GetTimestampUs
+(
+    void
+)
+{
+    const le_clk_Time_t now = le_clk_GetRelativeTime();
+    return (uint64_t)now.sec * 1000000 + now.usec;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * An event handler which is parameterized to handle the interrupts of all GPIO expanders
+ *
+ * The handler will call the handler for each GPIO which has triggered due to an edge condition.
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioExpander_GenericInterruptHandler
+(
+    const gpioExpander_Identifier_t *expander,
+    const gpioExpander_HandlerRecord_t *handlers
+)
+{
+    gpioExpander_TimedInterruptHandler(expander, handlers, gpioExpander_GetTimestampUs());
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Services the interrupt of a GPIO expander and reports the given time of the interrupt to the
+ * handlers
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioExpander_TimedInterruptHandler
+(
+    const gpioExpander_Identifier_t *expander,
+    const gpioExpander_HandlerRecord_t *handlers,
+    uint64_t timestampUs
+)
+{
+    Sx1509State_t *state = Sx1509GetState(expander);
+
+    // While the keypad engine is on, the event status is skipped if no GPIO can interrupt
+    const bool readKeys = (state->keyHandlerPtr != NULL);
+    Sx1509EventReader_t reader = { .expander = expander, .handlePtr = NULL };
+    Sx1509InterruptSample_t sample;
+    Sx1509CaptureEvents(
+        &reader,
+        readKeys,
+        !readKeys || Sx1509HasUnmaskedInterrupts(expander),
+        timestampUs,
+        &sample);
+    Sx1509DispatchSample(expander, state, handlers, &sample);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the interrupt servicing statistics of the given GPIO expander
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioExpander_GetInterruptStats
+(
+    const gpioExpander_Identifier_t *expander,
+    gpioExpander_InterruptStats_t *stats       ///< [OUT] Statistics since the service started
+)
+{
+    const Sx1509State_t *state = Sx1509GetState(expander);
+    *stats = state->interruptStats;
+    stats->throttledPins = state->stormMask;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the number of events per second of a GPIO above which its interrupt is throttled
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioExpander_SetStormLimit
+(
+    const gpioExpander_Identifier_t *expander,
+    uint32_t eventsPerSecond
+)
+{
+    Sx1509GetState(expander)->stormLimit = eventsPerSecond;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a thread which services the interrupt line of the given expander
+ */
+//--------------------------------------------------------------------------------------------------
+gpioExpander_InterruptThreadRef_t gpioExpander_CreateInterruptThread
+(
+    const char *name,
+    le_thread_Priority_t priority,
+    const gpioExpander_Identifier_t *expander,
+    const gpioExpander_HandlerRecord_t *handlers
+)
+{
+    LE_FATAL_IF(
+        NumInterruptThreads == SX1509_MAX_INTERRUPT_THREADS,
+        "No room for interrupt thread %s",
+        name);
+    struct gpioExpander_InterruptThread *thread = &InterruptThreads[NumInterruptThreads++];
+
+    gpioExpander_BindInterrupt(expander);
+    Sx1509InterruptSource_t *source = &thread->sources[thread->numSources++];
+    source->expander = expander;
+    source->handlers = handlers;
+    source->state = Sx1509GetState(expander);
+    source->handle = LE_FAULT;
+
+    thread->eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    LE_FATAL_IF(thread->eventFd < 0, "Couldn't create event fd of %s (%m)", name);
+    thread->fdMonitor =
+        le_fdMonitor_Create(name, thread->eventFd, &Sx1509InterruptQueueHandler, POLLIN);
+    le_fdMonitor_SetContextPtr(thread->fdMonitor, thread);
+
+    thread->thread = le_thread_Create(name, &Sx1509InterruptThreadMain, thread);
+    if (le_thread_SetPriority(thread->thread, priority) != LE_OK)
+    {
+        // The interrupt is still serviced, only with less predictable latency
+        LE_WARN("Couldn't set the priority of %s.  Is maxPriority of the process too low?", name);
+    }
+
+    return thread;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Services an expander whose interrupt is cascaded through a GPIO of the expander of the thread
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioExpander_AddCascadedInterrupt
+(
+    gpioExpander_InterruptThreadRef_t thread,
+    uint8_t parentPin,
+    gpioExpander_Edge_t edge,
+    const gpioExpander_Identifier_t *expander,
+    const gpioExpander_HandlerRecord_t *handlers
+)
+{
+    LE_FATAL_IF(
+        thread->numSources == SX1509_INTERRUPT_THREAD_MAX_EXPANDERS,
+        "No room for another cascaded GPIO expander");
+
+    const gpioExpander_Identifier_t *parent = thread->sources[0].expander;
+    LE_FATAL_IF(
+        gpioExpander_SetEdgeSense(parent, parentPin, edge) != LE_OK ||
+        EnableInterrupt(parent, parentPin, true) != LE_OK,
+        "Failed to enable the interrupt of GPIO %d of GPIO expander on I2C bus %d at address 0x%x",
+        parentPin,
+        parent->i2cBus,
+        parent->i2cAddr);
+    thread->sources[0].state->cascadeMask |= (1 << parentPin);
+
+    gpioExpander_BindInterrupt(expander);
+    Sx1509InterruptSource_t *source = &thread->sources[thread->numSources++];
+    source->expander = expander;
+    source->handlers = handlers;
+    source->state = Sx1509GetState(expander);
+    source->parentPin = parentPin;
+    source->handle = LE_FAULT;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts an interrupt thread
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioExpander_StartInterruptThread
+(
+    gpioExpander_InterruptThreadRef_t thread,
+    gpioExpander_InterruptBindFunc_t bindFunc,
+    void *contextPtr
+)
+{
+    thread->bindFunc = bindFunc;
+    thread->bindContextPtr = contextPtr;
+    le_thread_Start(thread->thread);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Services the interrupt line of an interrupt thread.  Runs in the interrupt thread.
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioExpander_ServiceInterruptThread
+(
+    gpioExpander_InterruptThreadRef_t thread
+)
+{
+    // Captured before anything else so that the I2C transfers aren't included
+    const uint64_t timestampUs = gpioExpander_GetTimestampUs();
+
+    uint16_t cascadedStatus = 0;
+    for (uint8_t i = 0; i < thread->numSources; i++)
+    {
+        Sx1509InterruptSource_t *source = &thread->sources[i];
+        if (i > 0 && (cascadedStatus & (1 << source->parentPin)) == 0)
+        {
+            continue;
+        }
+
+        Sx1509EventReader_t reader = { .expander = source->expander, .handlePtr = &source->handle };
+        Sx1509InterruptSample_t sample;
+        Sx1509CaptureEvents(
+            &reader,
+            __atomic_load_n(&source->state->keyHandlerPtr, __ATOMIC_ACQUIRE) != NULL,
+            true,
+            timestampUs,
+            &sample);
+
+        // The cascaded expanders whose interrupt GPIO had an event are serviced next
+        if (i == 0)
+        {
+            cascadedStatus = sample.overrunStatus;
+            for (uint8_t pass = 0; pass < sample.numPasses; pass++)
+            {
+                cascadedStatus |= sample.status[pass];
+            }
+        }
+
+        Sx1509QueueSample(thread, i, &sample);
+    }
+
+    const uint64_t count = 1;
+    if (write(thread->eventFd, &count, sizeof(count)) != sizeof(count))
+    {
+        LE_ERROR("Couldn't signal the main thread (%m)");
+    }
+}
+
+le_result_t gpioExpander_DiscoverPrimaryI2cBusNum
+(
+    uint8_t *busNum  ///< [OUT] Primary I2C bus number
+)
+{
+    const char *prefix = "/dev/i2c-";
+    const uint8_t numsToTry[] = {0, 4};
+    char path[16];
+
+    for (int i = 0; i < NUM_ARRAY_MEMBERS(numsToTry); i++)
+    {
+        struct stat statBuf = {};
+        const int formattedStringLen = snprintf(path, sizeof(path), "%s%d", prefix, numsToTry[i]);
+        LE_ASSERT(formattedStringLen < NUM_ARRAY_MEMBERS(path));
+        if (stat(path, &statBuf) == 0)
+        {
+            if (S_ISCHR(statBuf.st_mode))
+            {
+                *busNum = numsToTry[i];
+                return LE_OK;
+            }
+        }
+    }
+
+    return LE_NOT_FOUND;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts deferring register writes to all GPIO expanders
+ *
+ * Until the matching call to gpioExpander_FlushWrites(), writes are queued instead of being issued
+ * immediately.  When the queue is flushed the writes are grouped by I2C bus, starting with the bus
+ * which was used last, and consecutive writes to the same device are combined into as few
+ * transfers as possible.  When several expanders sit behind channels of an I2C switch, as on the
+ * Green board, this means that the switch is reconfigured once per bus rather than once per
+ * register.
+ *
+ * The writes on each bus are issued in the order in which they were made.  Writes on different
+ * buses are not ordered with respect to each other.
+ *
+ * Calls may be nested, in which case the queue is only flushed by the outermost
+ * gpioExpander_FlushWrites().
+ *
+ * @note
+ *      Functions which only queue writes return LE_OK.  Failures of the queued writes are reported
+ *      by gpioExpander_FlushWrites() instead.  Reads of a device first issue the writes queued for
+ *      its bus, so they always observe the effect of earlier writes.  gpioExpander_Reset() is never
+ *      deferred.
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioExpander_DeferWrites
+(
+    void
+)
+{
+    if (SchedDeferDepth == 0)
+    {
+        SchedFailed = false;
+    }
+    SchedDeferDepth++;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Ends a gpioExpander_DeferWrites() call and issues the queued writes if it was the outermost one
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT if any of the queued writes failed since the outermost
+ *        gpioExpander_DeferWrites()
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_FlushWrites
+(
+    void
+)
+{
+    LE_ASSERT(SchedDeferDepth > 0);
+    SchedDeferDepth--;
+    if (SchedDeferDepth > 0)
+    {
+        return LE_OK;
+    }
+
+    SchedFlushAll();
+    return SchedFailed ? LE_FAULT : LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Publishes the state of the GPIOs of the given expanders in a shared memory page
+ *
+ * The page is created if it doesn't exist yet.  An existing page is reused so that clients which
+ * mapped it before the service restarted keep seeing the current state.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_PublishState
+(
+    const gpioExpander_Identifier_t *expanders,
+    uint8_t numExpanders
+)
+{
+    LE_ASSERT(numExpanders <= GPIO_EXPANDER_STATE_PAGE_MAX_PORTS);
+    LE_ASSERT(StatePage == NULL);
+
+    const int fd = shm_open(GPIO_EXPANDER_STATE_PAGE_NAME, O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+    {
+        LE_ERROR("Couldn't open shared memory %s: %m", GPIO_EXPANDER_STATE_PAGE_NAME);
+        return LE_FAULT;
+    }
+
+    void *page = MAP_FAILED;
+    if (ftruncate(fd, sizeof(gpioExpanderStatePage_t)) == 0)
+    {
+        page = mmap(
+            NULL, sizeof(gpioExpanderStatePage_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (page == MAP_FAILED)
+    {
+        LE_ERROR("Couldn't map shared memory %s: %m", GPIO_EXPANDER_STATE_PAGE_NAME);
+        close(fd);
+        return LE_FAULT;
+    }
+    close(fd);
+
+    // Clients check the header before reading the ports, so it is written last.  A previous
+    // instance of the service may have died in the middle of a write and left a sequence odd, on
+    // which clients would wait forever.  It is moved on to the next even value, rather than back,
+    // so that a client which started reading before then still retries.
+    StatePage = page;
+    for (int i = 0; i < GPIO_EXPANDER_STATE_PAGE_MAX_PORTS; i++)
+    {
+        gpioExpanderStatePage_Port_t *port = &StatePage->ports[i];
+        __atomic_store_n(&port->sequence, (port->sequence + 1) & ~1u, __ATOMIC_RELEASE);
+        StatePageWritePort(port, 0, 0);
+    }
+    memcpy(StatePageExpanders, expanders, numExpanders * sizeof(expanders[0]));
+    StatePage->numPorts = numExpanders;
+    StatePage->version = GPIO_EXPANDER_STATE_PAGE_VERSION;
+    __atomic_store_n(&StatePage->magic, GPIO_EXPANDER_STATE_PAGE_MAGIC, __ATOMIC_RELEASE);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Installs the transport to be used for all subsequent I2C accesses
+ *
+ * Any handles held by the previous transport are closed first, and the shadow register files are
+ * discarded since they may describe devices of the previous transport.  That is refused while an
+ * expander is in use, as its handlers, polling and interrupt would be left with state which no
+ * longer exists.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_BUSY if an expander has a handler, a bound interrupt or is polled, an interrupt thread
+ *        was started or writes are deferred
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpander_SetI2cTransport
+(
+    const gpioExpander_I2cTransport_t *transport  ///< [IN] Transport to use or NULL for i2c-dev
+)
+{
+    if (NumInterruptThreads > 0 || SchedDeferDepth > 0)
+    {
+        return LE_BUSY;
+    }
+    for (int i = 0; i < SX1509_MAX_DEVICES; i++)
+    {
+        const Sx1509State_t *state = &Sx1509States[i];
+        if (state->inUse &&
+            ((state->pinHandlerMask | state->portHandlerMask | state->cascadeMask |
+              state->pollMask | state->stormMask) != 0 ||
+             state->keyHandlerPtr != NULL || state->interruptBound))
+        {
+            return LE_BUSY;
+        }
+    }
+
+    // The poll timers are idle, but would be lost along with the state
+    for (int i = 0; i < SX1509_MAX_DEVICES; i++)
+    {
+        if (Sx1509States[i].pollTimer != NULL)
+        {
+            le_timer_Delete(Sx1509States[i].pollTimer);
+        }
+    }
+
+    I2cCloseAllHandles();
+    memset(Sx1509States, 0, sizeof(Sx1509States));
+    SchedPendingCount = 0;
+    I2cLastBus = -1;
+
+    I2cTransport = (transport != NULL) ? transport : &LinuxI2cTransport;
+    LE_INFO("Using the %s I2C transport", I2cTransport->name);
+
+    return LE_OK;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Static functions
+//-------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the file handle for the given I2C bus and configure it for access to the given I2C address.
+ *
+ * @return
+ *      - LE_FAULT on failure
+ *      - A filehandle to the I2C bus
+ */
+//--------------------------------------------------------------------------------------------------
+static int I2cAccessBusAddr
+(
+    uint8_t i2cBus,
+    uint8_t i2cAddr
+)
+{
+    const size_t filenameSize = 32;
+    char filename[filenameSize];
+
+    snprintf(filename, filenameSize, "/dev/i2c/%d", i2cBus);
+
+    LE_DEBUG("Opening I2C bus: '%s'", filename);
+    int fd = open(filename, O_RDWR);
+    if (fd < 0 && (errno == ENOENT || errno == ENOTDIR))
+    {
+        snprintf(filename, filenameSize, "/dev/i2c-%d", i2cBus);
+        LE_DEBUG("Opening I2C bus: '%s'", filename);
+        fd = open(filename, O_RDWR);
+    }
+
+    if (fd < 0)
+    {
+        if (errno == ENOENT)
+        {
+            LE_ERROR(
+                "Could not open file /dev/i2c-%d or /dev/i2c/%d: %s\n",
+                i2cBus,
+                i2cBus,
+                strerror(ENOENT));
+        }
+        else
+        {
+            LE_ERROR("Could not open file %s': %s\n", filename, strerror(errno));
+        }
+
+        return LE_FAULT;
+    }
+
+    if (ioctl(fd, I2C_SLAVE_FORCE, i2cAddr) < 0)
+    {
+        LE_ERROR("Could not set address to 0x%02x: %s\n", i2cAddr, strerror(errno));
+        close(fd);
+        return LE_FAULT;
+    }
+
+    return fd;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Closes a file handle returned by I2cAccessBusAddr()
+ */
+//--------------------------------------------------------------------------------------------------
+static void LinuxI2cClose
+(
+    int fd
+)
+{
+    close(fd);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs an SMBUS read of a 1 byte register using i2c-dev
+ *
+ * @return
+ *      The value of the register or a negative value on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static int LinuxI2cReadByteData
+(
+    int fd,
+    uint8_t reg
+)
+{
+    return i2c_smbus_read_byte_data(fd, reg);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs an SMBUS write of a 1 byte register using i2c-dev
+ *
+ * @return
+ *      0 on success or a negative value on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static int LinuxI2cWriteByteData
+(
+    int fd,
+    uint8_t reg,
+    uint8_t data
+)
+{
+    return i2c_smbus_write_byte_data(fd, reg, data);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs an I2C block read of consecutive registers using i2c-dev
+ *
+ * @return
+ *      The number of bytes read or a negative value on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static int LinuxI2cReadBlockData
+(
+    int fd,
+    uint8_t reg,
+    uint8_t length,
+    uint8_t *data
+)
+{
+    return i2c_smbus_read_i2c_block_data(fd, reg, length, data);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs an I2C block write of consecutive registers using i2c-dev
+ *
+ * @return
+ *      0 on success or a negative value on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static int LinuxI2cWriteBlockData
+(
+    int fd,
+    uint8_t reg,
+    uint8_t length,
+    const uint8_t *data
+)
+{
+    return i2c_smbus_write_i2c_block_data(fd, reg, length, data);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs several register writes as a single I2C_RDWR transfer using i2c-dev.  The kernel holds
+ * the adapter lock for the whole transfer and separates the messages with repeated STARTs, so no
+ * other traffic can reach the device in between.
+ *
+ * @return
+ *      0 on success or a negative value on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static int LinuxI2cWriteRegs
+(
+    int fd,
+    uint8_t i2cAddr,
+    const gpioExpander_I2cRegWrite_t *writes,
+    uint8_t count
+)
+{
+    uint8_t buffers[GPIO_EXPANDER_MAX_REG_WRITES][2];
+    struct i2c_msg msgs[GPIO_EXPANDER_MAX_REG_WRITES];
+
+    LE_ASSERT(count <= GPIO_EXPANDER_MAX_REG_WRITES);
+    for (int i = 0; i < count; i++)
+    {
+        buffers[i][0] = writes[i].reg;
+        buffers[i][1] = writes[i].data;
+        msgs[i].addr = i2cAddr;
+        msgs[i].flags = 0;
+        msgs[i].len = sizeof(buffers[i]);
+        msgs[i].buf = (char *)buffers[i];
+    }
+
+    struct i2c_rdwr_ioctl_data rdwr =
+    {
+        .msgs = msgs,
+        .nmsgs = count,
+    };
+
+    return (ioctl(fd, I2C_RDWR, &rdwr) < 0) ? -1 : 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a transport handle for the given I2C bus which is configured for access to the given I2C
+ * address.  The handle is opened on first use and cached so that subsequent accesses don't pay for
+ * the open/ioctl/close sequence.
+ *
+ * @return
+ *      - LE_FAULT on failure, including when the cache is full
+ *      - A handle to the I2C device.  The caller must not close it.
+ */
+//--------------------------------------------------------------------------------------------------
+static int I2cGetHandle
+(
+    uint8_t i2cBus,
+    uint8_t i2cAddr
+)
+{
+    I2cHandle_t *freeSlot = NULL;
+    for (int i = 0; i < I2C_HANDLE_CACHE_SIZE; i++)
+    {
+        I2cHandle_t *handle = &I2cHandles[i];
+        if (!handle->inUse)
+        {
+            if (freeSlot == NULL)
+            {
+                freeSlot = handle;
+            }
+        }
+        else if (handle->i2cBus == i2cBus && handle->i2cAddr == i2cAddr)
+        {
+            return handle->handle;
+        }
+    }
+
+    if (freeSlot == NULL)
+    {
+        // More devices than expected.  There is nowhere to keep another handle and callers don't
+        // close it, so the access fails rather than leaking a handle each time.
+        LE_ERROR(
+            "I2C handle cache is full. Increase I2C_HANDLE_CACHE_SIZE (currently %d).",
+            I2C_HANDLE_CACHE_SIZE);
+        return LE_FAULT;
+    }
+
+    const int newHandle = I2cTransport->open(i2cBus, i2cAddr);
+    if (newHandle == LE_FAULT)
+    {
+        return LE_FAULT;
+    }
+
+    freeSlot->inUse = true;
+    freeSlot->i2cBus = i2cBus;
+    freeSlot->i2cAddr = i2cAddr;
+    freeSlot->handle = newHandle;
+
+    return newHandle;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Close and forget the cached handle for the given I2C bus and address (if any) so that the next
+ * access will reopen the bus.
+ */
+//--------------------------------------------------------------------------------------------------
+static void I2cInvalidateHandle
+(
+    uint8_t i2cBus,
+    uint8_t i2cAddr
+)
+{
+    for (int i = 0; i < I2C_HANDLE_CACHE_SIZE; i++)
+    {
+        I2cHandle_t *handle = &I2cHandles[i];
+        if (handle->inUse && handle->i2cBus == i2cBus && handle->i2cAddr == i2cAddr)
+        {
+            LE_WARN("Reopening I2C bus %d for access to address 0x%x", i2cBus, i2cAddr);
+            I2cTransport->close(handle->handle);
+            handle->inUse = false;
+            return;
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Close all cached I2C handles.
+ */
+//--------------------------------------------------------------------------------------------------
+static void I2cCloseAllHandles
+(
+    void
+)
+{
+    for (int i = 0; i < I2C_HANDLE_CACHE_SIZE; i++)
+    {
+        I2cHandle_t *handle = &I2cHandles[i];
+        if (handle->inUse)
+        {
+            I2cTransport->close(handle->handle);
+            handle->inUse = false;
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether an errno value reported by an I2C transfer indicates that the file handle itself
+ * may no longer be usable, as opposed to the device simply not responding to one transfer.
+ *
+ * @return
+ *      true if the handle should be reopened
+ */
+//--------------------------------------------------------------------------------------------------
+static bool I2cIsStaleHandleError
+(
+    int err
+)
+{
+    return (err == ENODEV || err == EIO || err == ENXIO || err == EBADF);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs an SMBUS read of a 1 byte register
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SmbusReadReg
+(
+    uint8_t i2cBus,  ///< [IN] I2C bus to perform the read on
+    uint8_t i2cAddr, ///< [IN] I2C address to read from
+    uint8_t reg,     ///< [IN] Register within the I2C device to read
+    uint8_t *data    ///< [OUT] Value stored within the register.  This value is only valid if the
+                     ///  function returned LE_OK.
+)
+{
+    int readResult = -1;
+
+    // Writes which are still queued for the device must reach it before it is read
+    SchedFlushBus(i2cBus);
+
+    // If the cached handle has gone stale (eg. the adapter was removed and re-added), drop it and
+    // make a single further attempt with a freshly opened handle.
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        const int i2cHandle = I2cGetHandle(i2cBus, i2cAddr);
+        if (i2cHandle == LE_FAULT) {
+            LE_ERROR("failed to open i2c bus %d for access to address %d\n", i2cBus, i2cAddr);
+            return  LE_FAULT;
+        }
+
+        I2cTransactionCount++;
+        I2cLastBus = i2cBus;
+        readResult = I2cTransport->readByteData(i2cHandle, reg);
+        if (readResult >= 0 || !I2cIsStaleHandleError(errno))
+        {
+            break;
+        }
+        I2cInvalidateHandle(i2cBus, i2cAddr);
+    }
+
+    if (readResult < 0)
+    {
+        LE_ERROR("smbus read failed with error %d", readResult);
+        return LE_FAULT;
+    }
+
+    *data = readResult;
+    LE_DEBUG("SMBUS READ addr=0x%x, reg=0x%x, data=0x%x", i2cAddr, reg, *data);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs an SMBUS write of a 1 byte register
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SmbusWriteReg
+(
+    uint8_t i2cBus,  ///< [IN] I2C bus to perform the write on
+    uint8_t i2cAddr, ///< [IN] Address of the I2C device to write
+    uint8_t reg,     ///< [IN] Register within the I2C device to write
+    uint8_t data     ///< [IN] Data to write to the given register
+)
+{
+    if (SchedIsDeferring())
+    {
+        return SchedQueueBlock(i2cBus, i2cAddr, reg, 1, &data);
+    }
+
+    return SmbusWriteRegNow(i2cBus, i2cAddr, reg, data);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs an SMBUS write of a 1 byte register without deferring it
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SmbusWriteRegNow
+(
+    uint8_t i2cBus,  ///< [IN] I2C bus to perform the write on
+    uint8_t i2cAddr, ///< [IN] Address of the I2C device to write
+    uint8_t reg,     ///< [IN] Register within the I2C device to write
+    uint8_t data     ///< [IN] Data to write to the given register
+)
+{
+    int writeResult = -1;
+
+    // See SmbusReadReg() for a description of the retry
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        const int i2cHandle = I2cGetHandle(i2cBus, i2cAddr);
+        if (i2cHandle == LE_FAULT) {
+            LE_ERROR("failed to open i2c bus %d for access to address %d\n", i2cBus, i2cAddr);
+            return LE_FAULT;
+        }
+
+        I2cTransactionCount++;
+        I2cLastBus = i2cBus;
+        writeResult = I2cTransport->writeByteData(i2cHandle, reg, data);
+        if (writeResult >= 0 || !I2cIsStaleHandleError(errno))
+        {
+            break;
+        }
+        I2cInvalidateHandle(i2cBus, i2cAddr);
+    }
+
+    if (writeResult < 0)
+    {
+        LE_ERROR("smbus write failed with error %d", writeResult);
+        return LE_FAULT;
+    }
+
+    LE_DEBUG("SMBUS WRITE addr=0x%x, reg=0x%x, data=0x%x", i2cAddr, reg, data);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs an I2C block read of consecutive registers using the auto-increment feature of the
+ * device
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SmbusReadBlock
+(
+    uint8_t i2cBus,  ///< [IN] I2C bus to perform the read on
+    uint8_t i2cAddr, ///< [IN] I2C address to read from
+    uint8_t reg,     ///< [IN] First register within the I2C device to read
+    uint8_t length,  ///< [IN] Number of consecutive registers to read
+    uint8_t *data    ///< [OUT] Values of the registers.  Only valid if the function returned LE_OK.
+)
+{
+    int readResult = -1;
+
+    SchedFlushBus(i2cBus);
+
+    // See SmbusReadReg() for a description of the retry
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        const int i2cHandle = I2cGetHandle(i2cBus, i2cAddr);
+        if (i2cHandle == LE_FAULT) {
+            LE_ERROR("failed to open i2c bus %d for access to address %d\n", i2cBus, i2cAddr);
+            return LE_FAULT;
+        }
+
+        I2cTransactionCount++;
+        I2cLastBus = i2cBus;
+        readResult = I2cTransport->readBlockData(i2cHandle, reg, length, data);
+        if (readResult >= 0 || !I2cIsStaleHandleError(errno))
+        {
+            break;
+        }
+        I2cInvalidateHandle(i2cBus, i2cAddr);
+    }
+
+    if (readResult != length)
+    {
+        LE_ERROR("i2c block read failed with result %d", readResult);
+        return LE_FAULT;
+    }
+
+    LE_DEBUG("I2C BLOCK READ addr=0x%x, reg=0x%x, length=%d", i2cAddr, reg, length);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs an I2C block write of consecutive registers using the auto-increment feature of the
+ * device
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SmbusWriteBlock
+(
+    uint8_t i2cBus,      ///< [IN] I2C bus to perform the write on
+    uint8_t i2cAddr,     ///< [IN] Address of the I2C device to write
+    uint8_t reg,         ///< [IN] First register within the I2C device to write
+    uint8_t length,      ///< [IN] Number of consecutive registers to write
+    const uint8_t *data  ///< [IN] Data to write to the registers
+)
+{
+    if (SchedIsDeferring())
+    {
+        return SchedQueueBlock(i2cBus, i2cAddr, reg, length, data);
+    }
+
+    int writeResult = -1;
+
+    // See SmbusReadReg() for a description of the retry
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        const int i2cHandle = I2cGetHandle(i2cBus, i2cAddr);
+        if (i2cHandle == LE_FAULT) {
+            LE_ERROR("failed to open i2c bus %d for access to address %d\n", i2cBus, i2cAddr);
+            return LE_FAULT;
+        }
+
+        I2cTransactionCount++;
+        I2cLastBus = i2cBus;
+        writeResult = I2cTransport->writeBlockData(i2cHandle, reg, length, data);
+        if (writeResult >= 0 || !I2cIsStaleHandleError(errno))
+        {
+            break;
+        }
+        I2cInvalidateHandle(i2cBus, i2cAddr);
+    }
+
+    if (writeResult < 0)
+    {
+        LE_ERROR("i2c block write failed with error %d", writeResult);
+        return LE_FAULT;
+    }
+
+    LE_DEBUG("I2C BLOCK WRITE addr=0x%x, reg=0x%x, length=%d", i2cAddr, reg, length);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs several register writes as one combined I2C transfer.  If the transport doesn't
+ * support combined transfers the writes are issued one at a time.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t I2cWriteRegs
+(
+    uint8_t i2cBus,                           ///< [IN] I2C bus to perform the writes on
+    uint8_t i2cAddr,                          ///< [IN] Address of the I2C device to write
+    const gpioExpander_I2cRegWrite_t *writes, ///< [IN] Writes to perform, in order
+    uint8_t count                             ///< [IN] Number of writes
+)
+{
+    if (SchedIsDeferring())
+    {
+        return SchedQueueWrites(i2cBus, i2cAddr, writes, count);
+    }
+
+    if (I2cTransport->writeRegs == NULL)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (SmbusWriteReg(i2cBus, i2cAddr, writes[i].reg, writes[i].data) != LE_OK)
+            {
+                return LE_FAULT;
+            }
+        }
+        return LE_OK;
+    }
+
+    int writeResult = -1;
+
+    // See SmbusReadReg() for a description of the retry
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        const int i2cHandle = I2cGetHandle(i2cBus, i2cAddr);
+        if (i2cHandle == LE_FAULT) {
+            LE_ERROR("failed to open i2c bus %d for access to address %d\n", i2cBus, i2cAddr);
+            return LE_FAULT;
+        }
+
+        I2cTransactionCount++;
+        I2cLastBus = i2cBus;
+        writeResult = I2cTransport->writeRegs(i2cHandle, i2cAddr, writes, count);
+        if (writeResult >= 0 || !I2cIsStaleHandleError(errno))
+        {
+            break;
+        }
+        I2cInvalidateHandle(i2cBus, i2cAddr);
+    }
+
+    if (writeResult < 0)
+    {
+        LE_ERROR("i2c combined write failed with error %d", writeResult);
+        return LE_FAULT;
+    }
+
+    LE_DEBUG("I2C COMBINED WRITE addr=0x%x, count=%d", i2cAddr, count);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether writes should be queued rather than issued.
+ *
+ * @return
+ *      true if writes are being deferred
+ */
+//--------------------------------------------------------------------------------------------------
+static bool SchedIsDeferring
+(
+    void
+)
+{
+    return (SchedDeferDepth > 0 && !SchedFlushing);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Appends register writes to the queue of deferred writes.  If the queue is full, everything queued
+ * so far is issued first.
+ *
+ * @return
+ *      - LE_OK
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SchedQueueWrites
+(
+    uint8_t i2cBus,                           ///< [IN] I2C bus the device is on
+    uint8_t i2cAddr,                          ///< [IN] Address of the I2C device to write
+    const gpioExpander_I2cRegWrite_t *writes, ///< [IN] Writes to queue, in order
+    uint8_t count                             ///< [IN] Number of writes
+)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (SchedPendingCount == SCHED_MAX_PENDING_WRITES)
+        {
+            LE_DEBUG("Deferred write queue is full. Flushing early.");
+            SchedFlushAll();
+        }
+
+        SchedPendingWrite_t *pending = &SchedPendingWrites[SchedPendingCount++];
+        pending->i2cBus = i2cBus;
+        pending->i2cAddr = i2cAddr;
+        pending->write = writes[i];
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Appends a write of consecutive registers to the queue of deferred writes.  The block is split
+ * into writes of the individual registers so that it can be combined with other writes to the same
+ * device.
+ *
+ * @return
+ *      - LE_OK
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SchedQueueBlock
+(
+    uint8_t i2cBus,      ///< [IN] I2C bus the device is on
+    uint8_t i2cAddr,     ///< [IN] Address of the I2C device to write
+    uint8_t reg,         ///< [IN] First register to write
+    uint8_t length,      ///< [IN] Number of consecutive registers to write
+    const uint8_t *data  ///< [IN] Data to write to the registers
+)
+{
+    for (int i = 0; i < length; i++)
+    {
+        const gpioExpander_I2cRegWrite_t write = { .reg = reg + i, .data = data[i] };
+        SchedQueueWrites(i2cBus, i2cAddr, &write, 1);
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Issues the queued writes for one bus in the order they were queued.  Consecutive writes to the
+ * same device are combined into as few transfers as possible.  If a write fails, the shadow of
+ * every register that was part of the failed transfer is invalidated and the failure is reported by
+ * gpioExpander_FlushWrites().
+ */
+//--------------------------------------------------------------------------------------------------
+static void SchedFlushBus
+(
+    uint8_t i2cBus  ///< [IN] I2C bus to issue the writes of
+)
+{
+    if (SchedFlushing || SchedPendingCount == 0)
+    {
+        return;
+    }
+    SchedFlushing = true;
+
+    gpioExpander_I2cRegWrite_t writes[GPIO_EXPANDER_MAX_REG_WRITES];
+    uint8_t count = 0;
+    uint8_t i2cAddr = 0;
+    int kept = 0;
+    for (int i = 0; i <= SchedPendingCount; i++)
+    {
+        const bool isBus = (i < SchedPendingCount && SchedPendingWrites[i].i2cBus == i2cBus);
+
+        // Issue a transfer once it is full, once the next write is to another device on the bus or
+        // once the end of the queue has been reached
+        if (count > 0 &&
+            (count == GPIO_EXPANDER_MAX_REG_WRITES || i == SchedPendingCount ||
+             (isBus && SchedPendingWrites[i].i2cAddr != i2cAddr)))
+        {
+            const le_result_t r = (count == 1) ?
+                SmbusWriteRegNow(i2cBus, i2cAddr, writes[0].reg, writes[0].data) :
+                I2cWriteRegs(i2cBus, i2cAddr, writes, count);
+            if (r != LE_OK)
+            {
+                LE_ERROR(
+                    "Deferred write failed on I2C bus %d at address 0x%x", i2cBus, i2cAddr);
+                SchedFailed = true;
+                for (int j = 0; j < count; j++)
+                {
+                    Sx1509InvalidateReg(i2cBus, i2cAddr, writes[j].reg);
+                }
+            }
+            count = 0;
+        }
+
+        if (isBus)
+        {
+            i2cAddr = SchedPendingWrites[i].i2cAddr;
+            writes[count++] = SchedPendingWrites[i].write;
+        }
+        else if (i < SchedPendingCount)
+        {
+            SchedPendingWrites[kept++] = SchedPendingWrites[i];
+        }
+    }
+    SchedPendingCount = kept;
+
+    SchedFlushing = false;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Issues all queued writes grouped by bus.  The bus which is currently selected is served first so
+ * that every bus is visited at most once.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SchedFlushAll
+(
+    void
+)
+{
+    while (SchedPendingCount > 0)
+    {
+        int bus = SchedPendingWrites[0].i2cBus;
+        for (int i = 0; i < SchedPendingCount; i++)
+        {
+            if (SchedPendingWrites[i].i2cBus == I2cLastBus)
+            {
+                bus = I2cLastBus;
+                break;
+            }
+        }
+
+        SchedFlushBus(bus);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs a masked SMBUS write of a 1 byte register
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SmbusReadModifyWrite
+(
+    uint8_t i2cBus,    ///< [IN] I2C bus to perform the masked write on
+    uint8_t i2cAddr,   ///< [IN] Address of the I2C device to perform the masked write on
+    uint8_t reg,       ///< [IN] Register within the I2C device to perform the masked write on
+    uint8_t writeData, ///< [IN] Value to write into the register
+    uint8_t writeMask  ///< [IN] Mask to apply to write.  Only bits which are set in the mask will
+                       ///  be written from the writeData parameter into the given register.
+)
+{
+    uint8_t data;
+    le_result_t r = SmbusReadReg(i2cBus, i2cAddr, reg, &data);
+    if (r != LE_OK)
+    {
+        LE_ERROR("Failed during read portion of SMBUS read-modify-write");
+        return LE_FAULT;
+    }
+
+    data = (data & ~writeMask) | (writeData & writeMask);
+
+    r = SmbusWriteReg(i2cBus, i2cAddr, reg, data);
+    if (r != LE_OK)
+    {
+        LE_ERROR("Failed during write portion of SMBUS read-modify-write");
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the driver state for the given GPIO expander, creating it on first use.
+ *
+ * @return
+ *      The state of the GPIO expander.  The function does not return if no state can be allocated.
+ */
+//--------------------------------------------------------------------------------------------------
+static Sx1509State_t *Sx1509GetState
+(
+    const gpioExpander_Identifier_t *expander
+)
+{
+    Sx1509State_t *freeSlot = NULL;
+    for (int i = 0; i < SX1509_MAX_DEVICES; i++)
+    {
+        Sx1509State_t *state = &Sx1509States[i];
+        if (!state->inUse)
+        {
+            if (freeSlot == NULL)
+            {
+                freeSlot = state;
+            }
+        }
+        else if (state->i2cBus == expander->i2cBus && state->i2cAddr == expander->i2cAddr)
+        {
+            return state;
+        }
+    }
+
+    LE_FATAL_IF(
+        freeSlot == NULL,
+        "No room for state of GPIO expander on I2C bus %d at address 0x%x",
+        expander->i2cBus,
+        expander->i2cAddr);
+
+    memset(freeSlot, 0, sizeof(*freeSlot));
+    freeSlot->inUse = true;
+    freeSlot->i2cBus = expander->i2cBus;
+    freeSlot->i2cAddr = expander->i2cAddr;
+    freeSlot->stormLimit = SX1509_STORM_DEFAULT_LIMIT;
+
+    return freeSlot;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Writes a port of the published state under its sequence lock.
+ *
+ * Only the service's main thread writes to the page, so the sequence needs no atomic increment.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StatePageWritePort
+(
+    gpioExpanderStatePage_Port_t *port,
+    uint16_t value,     ///< [IN] Bit n holds the value of GPIO n
+    uint16_t validMask  ///< [IN] Bit n is set if the value of GPIO n is known
+)
+{
+    const uint64_t now = gpioExpander_GetTimestampUs();
+    const uint32_t sequence = port->sequence;
+    __atomic_store_n(&port->sequence, sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&port->value, value, __ATOMIC_RELAXED);
+    __atomic_store_n(&port->validMask, validMask, __ATOMIC_RELAXED);
+    __atomic_store_n(&port->updateTimeUs, now, __ATOMIC_RELAXED);
+    __atomic_store_n(&port->sequence, sequence + 2, __ATOMIC_RELEASE);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Updates the published value of some of the GPIOs of an expander.  Does nothing if the state is
+ * not published or the expander is not one of the published ones.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StatePageUpdate
+(
+    const gpioExpander_Identifier_t *expander,
+    uint16_t value,  ///< [IN] Bit n holds the value of GPIO n
+    uint16_t mask    ///< [IN] Bit n is set if the value of GPIO n is to be updated
+)
+{
+    if (StatePage == NULL)
+    {
+        return;
+    }
+
+    for (int i = 0; i < StatePage->numPorts; i++)
+    {
+        if (StatePageExpanders[i].i2cBus != expander->i2cBus ||
+            StatePageExpanders[i].i2cAddr != expander->i2cAddr)
+        {
+            continue;
+        }
+
+        gpioExpanderStatePage_Port_t *port = &StatePage->ports[i];
+        StatePageWritePort(port, (port->value & ~mask) | (value & mask), port->validMask | mask);
+        return;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Publishes the level that the output GPIOs are driven to after the output latch or the direction
+ * of GPIOs has been written.  GPIOs whose direction isn't known are left alone.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StatePagePublishOutputs
+(
+    const gpioExpander_Identifier_t *expander,
+    const Sx1509State_t *state,
+    uint16_t mask    ///< [IN] GPIOs which may have changed
+)
+{
+    if (StatePage == NULL || !state->dataOutValid ||
+        !Sx1509IsShadowValid(state, SX1509_REG_DIR_B) ||
+        !Sx1509IsShadowValid(state, SX1509_REG_DIR_A))
+    {
+        return;
+    }
+
+    const uint16_t outputs =
+        ~((state->shadow[SX1509_REG_DIR_B] << 8) | state->shadow[SX1509_REG_DIR_A]);
+    StatePageUpdate(expander, state->dataOut, mask & outputs);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether a register is mirrored in the shadow register file.
+ *
+ * Only registers whose value is changed exclusively by this driver may be shadowed.  Registers
+ * such as DATA, INTERRUPT_SOURCE and EVENT_STATUS reflect the state of the pins and so must always
+ * be read from the device.
+ *
+ * @return
+ *      true if the register is shadowed
+ */
+//--------------------------------------------------------------------------------------------------
+static bool Sx1509IsShadowedReg
+(
+    uint8_t reg
+)
+{
+    return (
+        (reg >= SX1509_REG_INPUT_DISABLE_B && reg <= SX1509_REG_DIR_A) ||
+        (reg >= SX1509_REG_INTERRUPT_MASK_B && reg <= SX1509_REG_SENSE_LOW_A) ||
+        (reg >= SX1509_REG_CLOCK && reg <= SX1509_REG_LED_DRIVER_ENABLE_A) ||
+        (reg >= SX1509_REG_DEBOUNCE_CONFIG && reg <= SX1509_REG_KEY_CONFIG_2) ||
+        (reg >= SX1509_REG_T_ON_0 && reg <= SX1509_REG_T_FALL_15));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether the shadow of a register matches the device.
+ *
+ * @return
+ *      true if the shadow is valid
+ */
+//--------------------------------------------------------------------------------------------------
+static bool Sx1509IsShadowValid
+(
+    const Sx1509State_t *state,
+    uint8_t reg
+)
+{
+    return (state->shadowValid[reg / 32] & (1U << (reg % 32))) != 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Marks the shadow of a register as matching the device or not.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Sx1509SetShadowValid
+(
+    Sx1509State_t *state,
+    uint8_t reg,
+    bool valid
+)
+{
+    if (valid)
+    {
+        state->shadowValid[reg / 32] |= (1U << (reg % 32));
+    }
+    else
+    {
+        state->shadowValid[reg / 32] &= ~(1U << (reg % 32));
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Loads the shadow register file with the values that the device has following a reset.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Sx1509ResetShadow
+(
+    Sx1509State_t *state
+)
+{
+    memcpy(state->shadow, Sx1509ShadowResetValues, sizeof(state->shadow));
+    for (uint8_t reg = 0; reg < SX1509_SHADOW_SIZE; reg++)
+    {
+        Sx1509SetShadowValid(state, reg, Sx1509IsShadowedReg(reg));
+    }
+
+    // RegDataB and RegDataA both reset to 0xFF
+    state->dataOut = 0xFFFF;
+    state->dataOutValid = true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads a register of the GPIO expander.  Shadowed registers are served from the shadow when it
+ * is valid and the shadow is filled in when it is not.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t Sx1509ReadReg
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t reg,                           ///< [IN] Register to read
+    uint8_t *data                          ///< [OUT] Value of the register
+)
+{
+    if (!Sx1509IsShadowedReg(reg))
+    {
+        return SmbusReadReg(expander->i2cBus, expander->i2cAddr, reg, data);
+    }
+
+    Sx1509State_t *state = Sx1509GetState(expander);
+    if (!Sx1509IsShadowValid(state, reg))
+    {
+        if (SmbusReadReg(expander->i2cBus, expander->i2cAddr, reg, &state->shadow[reg]) != LE_OK)
+        {
+            return LE_FAULT;
+        }
+        Sx1509SetShadowValid(state, reg, true);
+    }
+
+    *data = state->shadow[reg];
+    return LE_OK;
+}
 
 //--------------------------------------------------------------------------------------------------
 /**
- * The SX1509 GPIO Register Address - See datasheet for descriptions
- */
-//--------------------------------------------------------------------------------------------------
-typedef enum {
-    // Device and IO Banks
-    SX1509_REG_INPUT_DISABLE_B               = 0x00,
-    SX1509_REG_INPUT_DISABLE_A               = 0x01,
-    SX1509_REG_LONG_SLEW_B                   = 0x02,
-    SX1509_REG_LONG_SLEW_A                   = 0x03,
-    SX1509_REG_LOW_DRIVE_B                   = 0x04,
-    SX1509_REG_LOW_DRIVE_A                   = 0x05,
-    SX1509_REG_PULL_UP_B                     = 0x06,
-    SX1509_REG_PULL_UP_A                     = 0x07,
-    SX1509_REG_PULL_DOWN_B                   = 0x08,
-    SX1509_REG_PULL_DOWN_A                   = 0x09,
-    SX1509_REG_OPEN_DRAIN_B                  = 0x0A,
-    SX1509_REG_OPEN_DRAIN_A                  = 0x0B,
-    SX1509_REG_POLARITY_B                    = 0x0C,
-    SX1509_REG_POLARITY_A                    = 0x0D,
-    SX1509_REG_DIR_B                         = 0x0E,
-    SX1509_REG_DIR_A                         = 0x0F,
-    SX1509_REG_DATA_B                        = 0x10,
-    SX1509_REG_DATA_A                        = 0x11,
-    SX1509_REG_INTERRUPT_MASK_B              = 0x12,
-    SX1509_REG_INTERRUPT_MASK_A              = 0x13,
-    SX1509_REG_SENSE_HIGH_B                  = 0x14,
-    SX1509_REG_SENSE_LOW_B                   = 0x15,
-    SX1509_REG_SENSE_HIGH_A                  = 0x16,
-    SX1509_REG_SENSE_LOW_A                   = 0x17,
-    SX1509_REG_INTERRUPT_SOURCE_B            = 0x18,
-    SX1509_REG_INTERRUPT_SOURCE_A            = 0x19,
-    SX1509_REG_EVENT_STATUS_B                = 0x1A,
-    SX1509_REG_EVENT_STATUS_A                = 0x1B,
-    SX1509_REG_LEVEL_SHIFTER_1               = 0x1C,
-    SX1509_REG_LEVEL_SHIFTER_2               = 0x1D,
-    SX1509_REG_CLOCK                         = 0x1E,
-    SX1509_REG_MISC                          = 0x1F,
-    SX1509_REG_LED_DRIVER_ENABLE_B           = 0x20,
-    SX1509_REG_LED_DRIVER_ENABLE_A           = 0x21,
-    // Debounce and Keypad Engine
-    SX1509_REG_DEBOUNCE_CONFIG               = 0x22,
-    SX1509_REG_DEBOUNCE_ENABLE_B             = 0x23,
-    SX1509_REG_DEBOUNCE_ENABLE_A             = 0x24,
-    SX1509_REG_KEY_CONFIG_1                  = 0x25,
-    SX1509_REG_KEY_CONFIG_2                  = 0x26,
-    SX1509_REG_KEY_DATA_1                    = 0x27,
-    SX1509_REG_KEY_DATA_2                    = 0x28,
-    // LED Driver (PWM, blinking, breathing)
-    SX1509_REG_T_ON_0                        = 0x29,
-    SX1509_REG_I_ON_0                        = 0x2A,
-    SX1509_REG_OFF_0                         = 0x2B,
-    SX1509_REG_T_ON_1                        = 0x2C,
-    SX1509_REG_I_ON_1                        = 0x2D,
-    SX1509_REG_OFF_1                         = 0x2E,
-    SX1509_REG_T_ON_2                        = 0x2F,
-    SX1509_REG_I_ON_2                        = 0x30,
-    SX1509_REG_OFF_2                         = 0x31,
-    SX1509_REG_T_ON_3                        = 0x32,
-    SX1509_REG_I_ON_3                        = 0x33,
-    SX1509_REG_OFF_3                         = 0x34,
-    SX1509_REG_T_ON_4                        = 0x35,
-    SX1509_REG_I_ON_4                        = 0x36,
-    SX1509_REG_OFF_4                         = 0x37,
-    SX1509_REG_T_RISE_4                      = 0x38,
-    SX1509_REG_T_FALL_4                      = 0x39,
-    SX1509_REG_T_ON_5                        = 0x3A,
-    SX1509_REG_I_ON_5                        = 0x3B,
-    SX1509_REG_OFF_5                         = 0x3C,
-    SX1509_REG_T_RISE_5                      = 0x3D,
-    SX1509_REG_T_FALL_5                      = 0x3E,
-    SX1509_REG_T_ON_6                        = 0x3F,
-    SX1509_REG_I_ON_6                        = 0x40,
-    SX1509_REG_OFF_6                         = 0x41,
-    SX1509_REG_T_RISE_6                      = 0x42,
-    SX1509_REG_T_FALL_6                      = 0x43,
-    SX1509_REG_T_ON_7                        = 0x44,
-    SX1509_REG_I_ON_7                        = 0x45,
-    SX1509_REG_OFF_7                         = 0x46,
-    SX1509_REG_T_RISE_7                      = 0x47,
-    SX1509_REG_T_FALL_7                      = 0x48,
-    SX1509_REG_T_ON_8                        = 0x49,
-    SX1509_REG_I_ON_8                        = 0x4A,
-    SX1509_REG_OFF_8                         = 0x4B,
-    SX1509_REG_T_ON_9                        = 0x4C,
-    SX1509_REG_I_ON_9                        = 0x4D,
-    SX1509_REG_OFF_9                         = 0x4E,
-    SX1509_REG_T_ON_10                       = 0x4F,
-    SX1509_REG_I_ON_10                       = 0x50,
-    SX1509_REG_OFF_10                        = 0x51,
-    SX1509_REG_T_ON_11                       = 0x52,
-    SX1509_REG_I_ON_11                       = 0x53,
-    SX1509_REG_OFF_11                        = 0x54,
-    SX1509_REG_T_ON_12                       = 0x55,
-    SX1509_REG_I_ON_12                       = 0x56,
-    SX1509_REG_OFF_12                        = 0x57,
-    SX1509_REG_T_RISE_12                     = 0x58,
-    SX1509_REG_T_FALL_12                     = 0x59,
-    SX1509_REG_T_ON_13                       = 0x5A,
-    SX1509_REG_I_ON_13                       = 0x5B,
-    SX1509_REG_OFF_13                        = 0x5C,
-    SX1509_REG_T_RISE_13                     = 0x5D,
-    SX1509_REG_T_FALL_13                     = 0x5E,
-    SX1509_REG_T_ON_14                       = 0x5F,
-    SX1509_REG_I_ON_14                       = 0x60,
-    SX1509_REG_OFF_14                        = 0x61,
-    SX1509_REG_T_RISE_14                     = 0x62,
-    SX1509_REG_T_FALL_14                     = 0x63,
-    SX1509_REG_T_ON_15                       = 0x64,
-    SX1509_REG_I_ON_15                       = 0x65,
-    SX1509_REG_OFF_15                        = 0x66,
-    SX1509_REG_T_RISE_15                     = 0x67,
-    SX1509_REG_T_FALL_15                     = 0x68,
-    // Miscellaneous
-    SX1509_REG_HIGH_INPUT_B                  = 0x69,
-    SX1509_REG_HIGH_INPUT_A                  = 0x6A,
-    // Software Reset
-    SX1509_REG_RESET                         = 0x7D,
-    // Test (not to be written)
-    SX1509_REG_TEST_1                        = 0x7E,
-    SX1509_REG_TEST_2                        = 0x7F,
-} Sx1509GpioExpanderReg_t;
-
-typedef enum
+ * Performs a masked write of a register of the GPIO expander.
+ *
+ * For shadowed registers, the current value is taken from the shadow so only the write goes out on
+ * the bus, and the write is skipped if the register already holds the requested value.  Other
+ * registers fall back to a read-modify-write over the bus.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t Sx1509UpdateReg
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t reg,       ///< [IN] Register to perform the masked write on
+    uint8_t writeData, ///< [IN] Value to write into the register
+    uint8_t writeMask  ///< [IN] Mask to apply to write.  Only bits which are set in the mask will
+                       ///  be written from the writeData parameter into the given register.
+)
 {
-    SX1509_DIRECTION_OUTPUT = 0,
-    SX1509_DIRECTION_INPUT = 1,
-} Sx1509_Direction_t;
+    if (!Sx1509IsShadowedReg(reg))
+    {
+        return SmbusReadModifyWrite(expander->i2cBus, expander->i2cAddr, reg, writeData, writeMask);
+    }
 
-typedef enum
-{
-    SX1509_POLARITY_NORMAL = 0,
-    SX1509_POLARITY_INVERTED = 1,
-} Sx1509_Polarity_t;
+    uint8_t data;
+    if (Sx1509ReadReg(expander, reg, &data) != LE_OK)
+    {
+        LE_ERROR("Failed to read register 0x%x into the shadow", reg);
+        return LE_FAULT;
+    }
 
-typedef enum
-{
-    GPIO_EXPANDER_OUTPUT_TYPE_PUSH_PULL,
-    GPIO_EXPANDER_OUTPUT_TYPE_OPEN_DRAIN,
-    GPIO_EXPANDER_OUTPUT_TYPE_TRISTATE,
-} gpioExpander_OutputType_t;
+    const uint8_t newData = (data & ~writeMask) | (writeData & writeMask);
+    if (newData == data)
+    {
+        return LE_OK;
+    }
 
-//-------------------------------------------------------------------------------------------------
-// Static function declarations
-//-------------------------------------------------------------------------------------------------
+    Sx1509State_t *state = Sx1509GetState(expander);
+    if (SmbusWriteReg(expander->i2cBus, expander->i2cAddr, reg, newData) != LE_OK)
+    {
+        // The device may or may not have taken the write, so the shadow can no longer be trusted
+        Sx1509SetShadowValid(state, reg, false);
+        return LE_FAULT;
+    }
+    state->shadow[reg] = newData;
+    if (reg == SX1509_REG_DIR_B || reg == SX1509_REG_DIR_A)
+    {
+        StatePagePublishOutputs(expander, state, 0xFFFF);
+    }
 
-// Wrapper on top of low level linux i2c
-static int I2cAccessBusAddr(uint8_t i2cBus, uint8_t i2cAddr);
-static le_result_t SmbusReadReg(uint8_t i2cBus, uint8_t i2cAddr, uint8_t reg, uint8_t *data);
-static le_result_t SmbusWriteReg(uint8_t i2cBus, uint8_t i2cAddr, uint8_t reg, uint8_t data);
+    return LE_OK;
+}
 
-// Low level helper
-static le_result_t SmbusReadModifyWrite(
-    uint8_t i2cBus, uint8_t i2cAddr, uint8_t reg, uint8_t writeData, uint8_t writeMask);
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs a masked write of the output latch formed by DATA_B:DATA_A.
+ *
+ * The latch is tracked in the driver state so that no read is required.  Only the bank(s) touched
+ * by the mask are written and nothing is written if the latch already holds the requested value.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t Sx1509UpdateData
+(
+    const gpioExpander_Identifier_t *expander,
+    uint16_t writeData, ///< [IN] Value to write into the latch.  Bit n corresponds to GPIO n.
+    uint16_t writeMask  ///< [IN] Only bits which are set in the mask will be written
+)
+{
+    Sx1509State_t *state = Sx1509GetState(expander);
+    if (Sx1509LoadDataOut(expander, state) != LE_OK)
+    {
+        return LE_FAULT;
+    }
 
-// Mid-level helpers
-static void Sx1509ComputePinFieldAccessParameters(
-    uint8_t baseReg,
-    uint8_t pinNum,
-    uint8_t fieldWidth,
-    uint8_t *reg,
-    uint8_t *offsetInReg);
-static uint8_t CreateMask(uint8_t width);
-static uint8_t ExtractField(uint8_t data, uint8_t offset, uint8_t width);
+    const uint16_t newData = (state->dataOut & ~writeMask) | (writeData & writeMask);
+    const uint16_t changed = newData ^ state->dataOut;
+    const uint8_t data[2] = { newData >> 8, newData & 0xFF };
+    le_result_t r = LE_OK;
+    if ((changed & 0xFF00) != 0 && (changed & 0x00FF) != 0)
+    {
+        r = SmbusWriteBlock(
+            expander->i2cBus, expander->i2cAddr, SX1509_REG_DATA_B, sizeof(data), data);
+    }
+    else if ((changed & 0xFF00) != 0)
+    {
+        r = SmbusWriteReg(expander->i2cBus, expander->i2cAddr, SX1509_REG_DATA_B, data[0]);
+    }
+    else if ((changed & 0x00FF) != 0)
+    {
+        r = SmbusWriteReg(expander->i2cBus, expander->i2cAddr, SX1509_REG_DATA_A, data[1]);
+    }
 
-// High level functions
-static le_result_t Sx1509ReadPinField(
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin,
-    uint8_t baseReg,
-    uint8_t fieldWidth,
-    uint8_t *fieldData);
-static le_result_t Sx1509WritePinField(
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin,
-    uint8_t baseReg,
-    uint8_t fieldWidth,
-    uint8_t fieldData);
+    if (r != LE_OK)
+    {
+        state->dataOutValid = false;
+        return LE_FAULT;
+    }
+    state->dataOut = newData;
+    StatePagePublishOutputs(expander, state, writeMask);
 
-// Helper functions used to implement the public functions
-static le_result_t EnableInterrupt(
-    const gpioExpander_Identifier_t *expander, uint8_t pin, bool enable);
-static le_result_t WriteData(const gpioExpander_Identifier_t *expander, uint8_t pin, bool active);
-static le_result_t SetOutput(
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin,
-    gpioExpander_OutputType_t outputType,
-    gpioExpander_Polarity_t polarity,
-    bool value);
-static le_result_t SetPullType(
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin,
-    gpioExpander_PullUpDown_t pullType);
-static le_result_t SetPolarity(
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin,
-    gpioExpander_Polarity_t polarity);
-static le_result_t SetOutputType(
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Makes sure that the tracked output latch is valid, reading it from the device if required.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t Sx1509LoadDataOut
+(
     const gpioExpander_Identifier_t *expander,
-    uint8_t pin,
-    gpioExpander_OutputType_t outputType);
-static le_result_t SetDirection(
-    const gpioExpander_Identifier_t *expander, uint8_t pin, bool isInput);
+    Sx1509State_t *state
+)
+{
+    if (state->dataOutValid)
+    {
+        return LE_OK;
+    }
 
+    // The device hasn't been reset by this driver.  DATA reads back the pin levels, which for
+    // outputs is the latch value, so this is the best starting point available.
+    uint8_t data[2];
+    if (SmbusReadBlock(
+            expander->i2cBus, expander->i2cAddr, SX1509_REG_DATA_B, sizeof(data), data) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+    state->dataOut = ((data[0] << 8) | data[1]);
+    state->dataOutValid = true;
 
-//-------------------------------------------------------------------------------------------------
-// Public function definitions
-//-------------------------------------------------------------------------------------------------
+    return LE_OK;
+}
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Set the given GPIO as an input with the provided polarity
+ * Marks a register as no longer known.  Used when a write may or may not have reached the device.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Sx1509InvalidateReg
+(
+    uint8_t i2cBus,
+    uint8_t i2cAddr,
+    uint8_t reg
+)
+{
+    const gpioExpander_Identifier_t expander = { .i2cBus = i2cBus, .i2cAddr = i2cAddr };
+    Sx1509State_t *state = Sx1509GetState(&expander);
+    if (reg == SX1509_REG_DATA_B || reg == SX1509_REG_DATA_A)
+    {
+        state->dataOutValid = false;
+    }
+    else if (reg < SX1509_SHADOW_SIZE)
+    {
+        Sx1509SetShadowValid(state, reg, false);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs a masked write of a run of consecutive shadowed registers.
+ *
+ * The new values are computed against the shadow and only the span from the first to the last
+ * register which actually changes is written, using a single auto-incrementing block write.
+ * Unchanged registers inside the span are rewritten with their current value, which is harmless.
  *
  * @return
  *      - LE_OK
  *      - LE_FAULT
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t gpioExpander_SetInput
+static le_result_t Sx1509UpdateRegs
 (
     const gpioExpander_Identifier_t *expander,
-    uint8_t pin,
-    gpioExpander_Polarity_t polarity
+    uint8_t firstReg,         ///< [IN] First register to write
+    uint8_t count,            ///< [IN] Number of consecutive registers
+    const uint8_t *writeData, ///< [IN] Values to write into the registers
+    const uint8_t *writeMask  ///< [IN] Masks to apply to the write of each register.  Only bits
+                              ///  which are set will be written from writeData.
 )
 {
-    if (SetPolarity(expander, pin, polarity) != LE_OK)
+    uint8_t newData[SX1509_SHADOW_SIZE];
+    int firstChanged = -1;
+    int lastChanged = -1;
+
+    LE_ASSERT(firstReg + count <= SX1509_SHADOW_SIZE);
+    for (int i = 0; i < count; i++)
     {
-        return LE_FAULT;
+        const uint8_t reg = firstReg + i;
+        LE_ASSERT(Sx1509IsShadowedReg(reg));
+
+        uint8_t data;
+        if (Sx1509ReadReg(expander, reg, &data) != LE_OK)
+        {
+            LE_ERROR("Failed to read register 0x%x into the shadow", reg);
+            return LE_FAULT;
+        }
+
+        newData[i] = (data & ~writeMask[i]) | (writeData[i] & writeMask[i]);
+        if (newData[i] != data)
+        {
+            if (firstChanged < 0)
+            {
+                firstChanged = i;
+            }
+            lastChanged = i;
+        }
     }
 
-    if (SetDirection(expander, pin, true) != LE_OK)
+    if (firstChanged < 0)
+    {
+        return LE_OK;
+    }
+
+    const uint8_t reg = firstReg + firstChanged;
+    const uint8_t length = lastChanged - firstChanged + 1;
+    le_result_t r;
+    if (length == 1)
+    {
+        r = SmbusWriteReg(expander->i2cBus, expander->i2cAddr, reg, newData[firstChanged]);
+    }
+    else
     {
+        r = SmbusWriteBlock(
+            expander->i2cBus, expander->i2cAddr, reg, length, &newData[firstChanged]);
+    }
+
+    Sx1509State_t *state = Sx1509GetState(expander);
+    if (r != LE_OK)
+    {
+        for (int i = 0; i < length; i++)
+        {
+            Sx1509SetShadowValid(state, reg + i, false);
+        }
         return LE_FAULT;
     }
+    memcpy(&state->shadow[reg], &newData[firstChanged], length);
+    if (reg <= SX1509_REG_DIR_A && reg + length > SX1509_REG_DIR_B)
+    {
+        StatePagePublishOutputs(expander, state, 0xFFFF);
+    }
 
     return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Set the given GPIO as a push pull output with the provided polarity
+ * Performs a masked write of a B/A register pair which holds a 1 bit field for each GPIO.
  *
  * @return
  *      - LE_OK
  *      - LE_FAULT
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t gpioExpander_SetPushPullOutput
+static le_result_t Sx1509UpdateRegPair
 (
     const gpioExpander_Identifier_t *expander,
-    uint8_t pin,
-    gpioExpander_Polarity_t polarity,
-    bool value
+    uint8_t regB,        ///< [IN] The B register of the pair.  The A register follows it.
+    uint16_t writeData,  ///< [IN] Value to write.  Bit n corresponds to GPIO n.
+    uint16_t writeMask   ///< [IN] Only bits which are set in the mask will be written
 )
 {
-    return SetOutput(expander, pin, GPIO_EXPANDER_OUTPUT_TYPE_PUSH_PULL, polarity, value);
+    const uint8_t data[] = { writeData >> 8, writeData & 0xFF };
+    const uint8_t mask[] = { writeMask >> 8, writeMask & 0xFF };
+    return Sx1509UpdateRegs(expander, regB, sizeof(data), data, mask);
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Set the given GPIO as a tristate output with the provided polarity
+ * Starts an empty batch of register writes.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Sx1509BatchInit
+(
+    Sx1509Batch_t *batch,
+    const gpioExpander_Identifier_t *expander
+)
+{
+    batch->expander = expander;
+    batch->count = 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds a masked write of a register to a batch.  The current value is taken from an earlier write
+ * to the same register in the batch or else from the shadow (or output latch for DATA), and nothing
+ * is added if the register would not change.
  *
  * @return
- *      - LE_NOT_IMPLEMENTED
- *
- * @note
- *      Tristate output type is not currently supported.  It should be possible to implement by
- *      using the push-pull capability of the hardware for the active and inactive states and
- *      configuring as an input with neither pull-up nor pull-down resistors for the high-z state.
+ *      - LE_OK
+ *      - LE_FAULT
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t gpioExpander_SetTriStateOutput
+static le_result_t Sx1509BatchAddReg
 (
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin,
-    gpioExpander_Polarity_t polarity
+    Sx1509Batch_t *batch,
+    uint8_t reg,       ///< [IN] Register to write
+    uint8_t writeData, ///< [IN] Value to write into the register
+    uint8_t writeMask  ///< [IN] Only bits which are set in the mask will be written
 )
 {
-    // TODO: implement tristate
-    //return SetOutput(expander, pin, GPIO_EXPANDER_OUTPUT_TYPE_TRISTATE, polarity, value);
-    return LE_NOT_IMPLEMENTED;
+    gpioExpander_I2cRegWrite_t *pending = NULL;
+    for (int i = 0; i < batch->count; i++)
+    {
+        if (batch->writes[i].reg == reg)
+        {
+            pending = &batch->writes[i];
+        }
+    }
+
+    uint8_t data;
+    if (pending != NULL)
+    {
+        data = pending->data;
+    }
+    else if (reg == SX1509_REG_DATA_B || reg == SX1509_REG_DATA_A)
+    {
+        Sx1509State_t *state = Sx1509GetState(batch->expander);
+        if (Sx1509LoadDataOut(batch->expander, state) != LE_OK)
+        {
+            return LE_FAULT;
+        }
+        data = (reg == SX1509_REG_DATA_B) ? (state->dataOut >> 8) : (state->dataOut & 0xFF);
+    }
+    else if (Sx1509ReadReg(batch->expander, reg, &data) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    const uint8_t newData = (data & ~writeMask) | (writeData & writeMask);
+    if (newData == data)
+    {
+        return LE_OK;
+    }
+
+    if (pending != NULL)
+    {
+        pending->data = newData;
+        return LE_OK;
+    }
+
+    LE_ASSERT(batch->count < GPIO_EXPANDER_MAX_REG_WRITES);
+    batch->writes[batch->count].reg = reg;
+    batch->writes[batch->count].data = newData;
+    batch->count++;
+
+    return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Set the given GPIO as an open drain output with the provided polarity
+ * Adds a write of the field associated with a single pin to a batch.
  *
  * @return
  *      - LE_OK
  *      - LE_FAULT
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t gpioExpander_SetOpenDrainOutput
+static le_result_t Sx1509BatchAddPinField
 (
-    const gpioExpander_Identifier_t *expander,
+    Sx1509Batch_t *batch,
     uint8_t pin,
-    gpioExpander_Polarity_t polarity,
-    bool value
+    Sx1509PinField_t field,                ///< [IN] Field to write
+    uint8_t fieldData                      ///< [IN] Data to write into the field.  The data should
+                                           ///  be in the least significant bit(s).
 )
 {
-    return SetOutput(expander, pin, GPIO_EXPANDER_OUTPUT_TYPE_OPEN_DRAIN, polarity, value);
+    const Sx1509PinFieldAccess_t *access = Sx1509GetPinFieldAccess(pin, field);
+    return Sx1509BatchAddReg(batch, access->reg, fieldData << access->shift, access->mask);
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Enable a 42 kΩ pull-up resistor on the GPIO
+ * Adds a masked write of the output latch formed by DATA_B:DATA_A to a batch.
  *
  * @return
  *      - LE_OK
  *      - LE_FAULT
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t gpioExpander_EnablePullUp
+static le_result_t Sx1509BatchAddData
 (
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin
+    Sx1509Batch_t *batch,
+    uint16_t writeData, ///< [IN] Value to write into the latch.  Bit n corresponds to GPIO n.
+    uint16_t writeMask  ///< [IN] Only bits which are set in the mask will be written
 )
 {
-    return SetPullType(expander, pin, GPIO_EXPANDER_PULL_UP);
+    if ((writeMask & 0xFF00) != 0 &&
+        Sx1509BatchAddReg(batch, SX1509_REG_DATA_B, writeData >> 8, writeMask >> 8) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    if ((writeMask & 0x00FF) != 0 &&
+        Sx1509BatchAddReg(batch, SX1509_REG_DATA_A, writeData & 0xFF, writeMask & 0xFF) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Enable a 42 kΩ pull-down resistor on the GPIO
+ * Issues the writes of a batch as a single combined I2C transfer and updates the shadow to match.
  *
  * @return
  *      - LE_OK
  *      - LE_FAULT
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t gpioExpander_EnablePullDown
+static le_result_t Sx1509BatchCommit
 (
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin
+    Sx1509Batch_t *batch
 )
 {
-    return SetPullType(expander, pin, GPIO_EXPANDER_PULL_DOWN);
+    const gpioExpander_Identifier_t *expander = batch->expander;
+    le_result_t r = LE_OK;
+    if (batch->count == 1)
+    {
+        r = SmbusWriteReg(
+            expander->i2cBus, expander->i2cAddr, batch->writes[0].reg, batch->writes[0].data);
+    }
+    else if (batch->count > 1)
+    {
+        r = I2cWriteRegs(expander->i2cBus, expander->i2cAddr, batch->writes, batch->count);
+    }
+
+    // On failure the device may have taken some or all of the writes, so the affected registers
+    // can no longer be trusted
+    Sx1509State_t *state = Sx1509GetState(expander);
+    for (int i = 0; i < batch->count; i++)
+    {
+        const gpioExpander_I2cRegWrite_t *write = &batch->writes[i];
+        if (write->reg == SX1509_REG_DATA_B)
+        {
+            state->dataOut = (state->dataOut & 0x00FF) | (write->data << 8);
+            state->dataOutValid = state->dataOutValid && (r == LE_OK);
+        }
+        else if (write->reg == SX1509_REG_DATA_A)
+        {
+            state->dataOut = (state->dataOut & 0xFF00) | write->data;
+            state->dataOutValid = state->dataOutValid && (r == LE_OK);
+        }
+        else if (r == LE_OK)
+        {
+            state->shadow[write->reg] = write->data;
+        }
+        else
+        {
+            Sx1509SetShadowValid(state, write->reg, false);
+        }
+    }
+    batch->count = 0;
+
+    if (r == LE_OK)
+    {
+        StatePagePublishOutputs(expander, state, 0xFFFF);
+    }
+
+    return r;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Disable the pull-up and pull-down resistors on the GPIO
+ * Gets the location of the field of a pin.
  *
- * @return
- *      - LE_OK
- *      - LE_FAULT
+ * @note
+ *      The pin is asserted to be in the range 0..15.
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t gpioExpander_DisableResistors
-(
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin
+static const Sx1509PinFieldAccess_t *Sx1509GetPinFieldAccess(
+    uint8_t pin,            ///< [IN] Pin number of the field that the client wishes to access
+    Sx1509PinField_t field  ///< [IN] Field to access
 )
 {
-    return SetPullType(expander, pin, GPIO_EXPANDER_PULL_OFF);
+    LE_ASSERT(pin < NUM_ARRAY_MEMBERS(Sx1509PinFields[field]));
+    return &Sx1509PinFields[field][pin];
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Activate the given GPIO
+ * Reads the field associated with a single pin from a register
  *
  * @return
  *      - LE_OK
  *      - LE_FAULT
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t gpioExpander_Activate
-(
+static le_result_t Sx1509ReadPinField(
     const gpioExpander_Identifier_t *expander,
-    uint8_t pin
+    uint8_t pin,
+    Sx1509PinField_t field,                ///< [IN] Field to read
+    uint8_t *fieldData                     ///< [OUT] The extracted field data shifted into the
+                                           ///  least significant bit(s).
 )
 {
-    return WriteData(expander, pin, true);
+    const Sx1509PinFieldAccess_t *access = Sx1509GetPinFieldAccess(pin, field);
+
+    uint8_t data;
+    le_result_t r = Sx1509ReadReg(expander, access->reg, &data);
+    if (r != LE_OK)
+    {
+        LE_ERROR("Failed to read pin field");
+        return LE_FAULT;
+    }
+
+    *fieldData = (data & access->mask) >> access->shift;
+    return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Deactivate the given GPIO
+ * Writes the field associated with a signle pin from a register
  *
  * @return
  *      - LE_OK
  *      - LE_FAULT
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t gpioExpander_Deactivate
-(
+static le_result_t Sx1509WritePinField(
     const gpioExpander_Identifier_t *expander,
-    uint8_t pin
+    uint8_t pin,
+    Sx1509PinField_t field,                ///< [IN] Field to write
+    uint8_t fieldData                      ///< [IN] Data to write into the field.  The data should
+                                           ///  be in the least significant bit(s).
 )
 {
-    return WriteData(expander, pin, false);
+    const Sx1509PinFieldAccess_t *access = Sx1509GetPinFieldAccess(pin, field);
+
+    le_result_t r = Sx1509UpdateReg(
+        expander, access->reg, fieldData << access->shift, access->mask);
+    if (r != LE_OK)
+    {
+        LE_ERROR("Failed to read pin field");
+        return LE_FAULT;
+    }
+
+    return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Set the given GPIO to high-Z
+ * Gets the field associated with a single pin from a shadowed configuration register
  *
- * @return
- *      - LE_NOT_IMPLEMENTED
+ * The shadow is kept up to date by every write the driver makes, so the value is normally returned
+ * without any I2C traffic.  If the shadowed register has not been seen yet it is read from the
+ * device once.  Should that read fail, the last known value is returned instead since the
+ * le_gpio.api getters have no way to signal failure.
  *
- * @note
- *      Once this is implemented, it will only be valid for tristate outputs.
+ * @return
+ *      The field data shifted into the least significant bit(s)
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t gpioExpander_SetHighZ
-(
+static uint8_t Sx1509GetShadowedPinField(
     const gpioExpander_Identifier_t *expander,
-    uint8_t pin
+    uint8_t pin,
+    Sx1509PinField_t field                 ///< [IN] Field to get
 )
 {
-    // TODO: implement
-    LE_WARN("SetHighZ API not implemented in GPIO expander service");
-    return LE_NOT_IMPLEMENTED;
+    const Sx1509PinFieldAccess_t *access = Sx1509GetPinFieldAccess(pin, field);
+    LE_ASSERT(Sx1509IsShadowedReg(access->reg));
+
+    uint8_t data;
+    if (Sx1509ReadReg(expander, access->reg, &data) != LE_OK)
+    {
+        LE_WARN(
+            "Couldn't refresh shadow of register 0x%x. Using last known value.", access->reg);
+        data = Sx1509GetState(expander)->shadow[access->reg];
+    }
+
+    return (data & access->mask) >> access->shift;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Reads a value for the input GPIO specified
+ * Runs the expander from its internal 2 MHz oscillator, which clocks the debounce engine.  The
+ * clock register is shadowed, so this only costs a bus transfer the first time.
  *
  * @return
- *      - true if the input is active
- *      - false if the input is inactive
+ *      - LE_OK
+ *      - LE_FAULT
  */
 //--------------------------------------------------------------------------------------------------
-bool gpioExpander_Read
+static le_result_t Sx1509EnableOscillator
 (
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin
+    const gpioExpander_Identifier_t *expander
 )
 {
-    const uint8_t dataFieldWidth = 1;
-    uint8_t readVal;
-    const le_result_t r = Sx1509ReadPinField(
+    return Sx1509UpdateReg(
         expander,
-        pin,
-        SX1509_REG_DATA_A,
-        dataFieldWidth,
-        &readVal);
-
-    if (r != LE_OK)
-    {
-        // TODO: There is no way to give fail a read in le_gpio.api
-        LE_FATAL("Fault while reading GPIO");
-    }
-
-    return readVal == 1;
+        SX1509_REG_CLOCK,
+        SX1509_CLOCK_OSC_SOURCE_INTERNAL,
+        SX1509_CLOCK_OSC_SOURCE_MASK);
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Register the given handler for an edge transition of a GPIO configured as an input
+ * Converts a time into the setting of an LED driver timing register.  Settings 1 to 15 select that
+ * many units and settings 16 to 31 select that many long units, so there is a gap between 15 units
+ * and 16 long units which can't be produced.  The setting closest to the time is chosen and times
+ * shorter than a unit get the shortest setting.
  *
  * @return
  *      - LE_OK
- *      - LE_FAULT
- *
- * @note
- *      - The sampleMs parameter is not used in the SX1509 GPIO expander implementation
- *      - Only one handler may be registered for each GPIO
+ *      - LE_OUT_OF_RANGE if the time is longer than the longest setting or falls in the gap
  */
 //--------------------------------------------------------------------------------------------------
-gpioExpander_ChangeCallbackRef_t gpioExpander_AddChangeEventHandler
+static le_result_t Sx1509EncodeLedTime
 (
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin,
-    gpioExpander_HandlerRecord_t *handlerRecord,
-    gpioExpander_Edge_t edge,
-    gpioExpander_ChangeCallbackFunc_t handlerPtr,
-    void* contextPtr,
-    int32_t sampleMs
+    uint32_t timeMs,    ///< [IN] Requested time.  0 is encoded as setting 0.
+    uint64_t unitUs,    ///< [IN] Length of a unit in microseconds
+    uint8_t longScale,  ///< [IN] Number of units in a long unit
+    uint8_t *setting    ///< [OUT] Setting of the register
 )
 {
-    if (handlerRecord->handlerPtr != NULL)
+    const uint64_t timeUs = timeMs * 1000ULL;
+    if (timeUs > SX1509_LED_TIME_MAX_SETTING * longScale * unitUs)
     {
-        LE_KILL_CLIENT(
-            "Attempted to register a second handler for GPIO expander on I2C bus %d at address "
-            "0x%x for pin %d",
-            expander->i2cBus,
-            expander->i2cAddr,
-            pin);
+        return LE_OUT_OF_RANGE;
     }
-    handlerRecord->handlerPtr = handlerPtr;
-    handlerRecord->contextPtr = contextPtr;
 
-    // TODO: We need to find a better way to deal with the unlikely event of a failure.  The
-    // function can't return anything except an opaque reference, so we have no way of signalling
-    // failure to the client.
-    LE_FATAL_IF(
-        gpioExpander_SetEdgeSense(expander, pin, edge) != LE_OK,
-        "Failed to set edge sense during event handler registration");
-    LE_FATAL_IF(
-        EnableInterrupt(expander, pin, true) != LE_OK,
-        "Failed to enable interrupt during event handler registration");
+    *setting = 0;
+    if (timeMs == 0)
+    {
+        return LE_OK;
+    }
+
+    uint64_t bestError = UINT64_MAX;
+    uint64_t bestStepUs = unitUs;
+    for (uint8_t candidate = 1; candidate <= SX1509_LED_TIME_MAX_SETTING; candidate++)
+    {
+        const uint64_t stepUs = unitUs * ((candidate < 16) ? 1 : longScale);
+        const uint64_t candidateUs = candidate * stepUs;
+        const uint64_t error =
+            (candidateUs > timeUs) ? (candidateUs - timeUs) : (timeUs - candidateUs);
+        if (error < bestError)
+        {
+            bestError = error;
+            bestStepUs = stepUs;
+            *setting = candidate;
+        }
+    }
 
-    return (gpioExpander_ChangeCallbackRef_t)handlerRecord;
+    if (timeUs > unitUs && bestError * 2 > bestStepUs)
+    {
+        return LE_OUT_OF_RANGE;
+    }
+
+    return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Deregisters the event handler for changes in the specified pin
+ * Converts a time into the setting of a keypad engine timing field, which selects unit * 2^n.  The
+ * time is rounded up.
  *
- * The calling client will be killed if the provided ref parameter is not the reference that was
- * returned by the call to gpioExpander_AddChangeEventHandler.
+ * @return
+ *      - LE_OK
+ *      - LE_OUT_OF_RANGE if the time is longer than the longest setting
  */
 //--------------------------------------------------------------------------------------------------
-void gpioExpander_RemoveChangeEventHandler
+static le_result_t Sx1509EncodeKeyTime
 (
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin,
-    gpioExpander_HandlerRecord_t *handlerRecord,
-    gpioExpander_ChangeCallbackRef_t ref
+    uint32_t timeMs,  ///< [IN] Requested time
+    uint32_t unitMs,  ///< [IN] Time selected by setting 0
+    uint8_t *setting  ///< [OUT] Setting of the field
 )
 {
-    // Sanity check to make sure that the client held the reference and called with the correct
-    // one.
-    if ((gpioExpander_HandlerRecord_t *)ref != handlerRecord)
+    *setting = 0;
+    while ((unitMs << *setting) < timeMs)
     {
-        LE_KILL_CLIENT("Invalid handler reference");
+        if (*setting == SX1509_KEY_TIME_MAX_SETTING)
+        {
+            return LE_OUT_OF_RANGE;
+        }
+        (*setting)++;
     }
-    handlerRecord->handlerPtr = NULL;
-    handlerRecord->contextPtr = NULL;
 
-    // TODO: As above, need a better way to signal failure to the user
-    LE_FATAL_IF(
-        EnableInterrupt(expander, pin, false) != LE_OK,
-        "Failed to disable interrupt during event handler deregistration");
+    return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Sets the edge sensitivity of an input
- *
- * The edge sensitivity of an input is also set when the change event handler is registered, so
- * this function is only useful for changing the edge sensitivity of an input pin with a handler
- * already registered.
+ * Checks whether any GPIO of the expander has its interrupt unmasked.  The masks are served from
+ * the shadow register file, so this normally doesn't access the I2C bus.
  *
  * @return
- *      - LE_OK
- *      - LE_FAULT
+ *      true if any GPIO may raise an interrupt or the masks couldn't be read
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t gpioExpander_SetEdgeSense
+static bool Sx1509HasUnmaskedInterrupts
 (
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin,
-    gpioExpander_Edge_t trigger ///< Change(s) that should trigger the callback to be called.
+    const gpioExpander_Identifier_t *expander
 )
 {
-    const uint8_t edgeSenseFieldWidth = 2;
-    le_result_t r = Sx1509WritePinField(
-        expander,
-        pin,
-        SX1509_REG_SENSE_LOW_A,
-        edgeSenseFieldWidth,
-        trigger);
-    if (r != LE_OK)
+    uint8_t maskB;
+    uint8_t maskA;
+    if (Sx1509ReadReg(expander, SX1509_REG_INTERRUPT_MASK_B, &maskB) != LE_OK ||
+        Sx1509ReadReg(expander, SX1509_REG_INTERRUPT_MASK_A, &maskA) != LE_OK)
     {
-        LE_ERROR("Could not set edge sense");
-        return LE_FAULT;
+        return true;
     }
 
-    return LE_OK;
+    return (maskB != 0xFF || maskA != 0xFF);
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Gets the current edge sensitivity setting of a GPIO
- *
- * @return
- *      - The edge sensitivity of the GPIO
- *
- * @note
- *      There is no check performed to ensure that a handler has been registered nor is there a
- *      check to verify that the specified GPIO is an input.
+ * Finds the key reported by KEY_DATA_1 (columns) and KEY_DATA_2 (rows), in which a pressed key
+ * reads as a 0 bit.  If several keys are pressed, the lowest numbered row and column are reported.
  */
 //--------------------------------------------------------------------------------------------------
-gpioExpander_Edge_t gpioExpander_GetEdgeSense
+static void Sx1509DecodeKey
 (
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin
+    const uint8_t *keyData,  ///< [IN] KEY_DATA_1 and KEY_DATA_2
+    int *row,                ///< [OUT] Row of the key or -1 if no key is pressed
+    int *column              ///< [OUT] Column of the key or -1 if no key is pressed
 )
 {
-    const uint8_t edgeSenseFieldWidth = 2;
-    gpioExpander_Edge_t edge = 0;
-    const le_result_t r = Sx1509ReadPinField(
-        expander,
-        pin,
-        SX1509_REG_SENSE_LOW_A,
-        edgeSenseFieldWidth,
-        (uint8_t *)&edge);
-
-    // TODO: There is no way to signal failure in the le_gpio.api
-    LE_FATAL_IF(r != LE_OK, "Failed to get edge sense")
-
-    return edge;
+    *row = -1;
+    *column = -1;
+    for (int i = SX1509_KEY_MAX_LINES - 1; i >= 0; i--)
+    {
+        if ((keyData[1] & (1 << i)) == 0)
+        {
+            *row = i;
+        }
+        if ((keyData[0] & (1 << i)) == 0)
+        {
+            *column = i;
+        }
+    }
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Disables edge sensing for the given GPIO
+ * Reads which GPIOs have latched an event.  EVENT_STATUS_B and EVENT_STATUS_A are adjacent, so
+ * both are read with a single transfer.
  *
  * @return
  *      - LE_OK
  *      - LE_FAULT
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t gpioExpander_DisableEdgeSense
+static le_result_t Sx1509ReadEventStatus
 (
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin
+    Sx1509EventReader_t *reader,
+    uint16_t *status  ///< [OUT] Bit n is set if GPIO n has latched an event
 )
 {
-    return gpioExpander_SetEdgeSense(expander, pin, GPIO_EXPANDER_EDGE_NONE);
+    uint8_t statusBytes[2];
+    if (Sx1509ReaderReadBlock(
+            reader, SX1509_REG_EVENT_STATUS_B, sizeof(statusBytes), statusBytes) != LE_OK)
+    {
+        LE_ERROR(
+            "Couldn't read interrupt status of GPIO expander on I2C bus %d at address 0x%x",
+            reader->expander->i2cBus,
+            reader->expander->i2cAddr);
+        return LE_FAULT;
+    }
+
+    *status = ((statusBytes[0] << 8) | statusBytes[1]);
+    return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Checks if the given GPIO is an output
+ * Clears the given events with a single transfer.  The bits are cleared by writing ones, so events
+ * of other GPIOs which were latched in the meantime are kept.
  *
  * @return
- *      true if the specified GPIO is an output or false otherwise
+ *      - LE_OK
+ *      - LE_FAULT
  */
 //--------------------------------------------------------------------------------------------------
-bool gpioExpander_IsOutput
+static le_result_t Sx1509ClearEventStatus
 (
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin
+    Sx1509EventReader_t *reader,
+    uint16_t status  ///< [IN] Bit n is set to clear the event of GPIO n
 )
 {
-    const uint8_t directionFieldWidth = 1;
-    Sx1509_Direction_t direction;
-    const le_result_t r = Sx1509ReadPinField(
-        expander,
-        pin,
-        SX1509_REG_DIR_A,
-        directionFieldWidth,
-        (uint8_t *)&direction);
-
-    // TODO: There is no way to signal failure in the le_gpio.api
-    LE_FATAL_IF (r != LE_OK, "Failed to check if GPIO direction")
-
-    return direction == SX1509_DIRECTION_OUTPUT;
+    const uint8_t statusBytes[] = { status >> 8, status & 0xFF };
+    return Sx1509ReaderWriteBlock(
+        reader, SX1509_REG_EVENT_STATUS_B, sizeof(statusBytes), statusBytes);
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Checks if the given GPIO is an input
+ * Reads consecutive registers for the interrupt service.  A handle of an interrupt thread is
+ * reopened once if it has gone stale, as SmbusReadBlock() does for the cached handles.
  *
  * @return
- *      true if the specified GPIO is an input or false otherwise
+ *      - LE_OK
+ *      - LE_FAULT
  */
 //--------------------------------------------------------------------------------------------------
-bool gpioExpander_IsInput
+static le_result_t Sx1509ReaderReadBlock
 (
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin
+    Sx1509EventReader_t *reader,
+    uint8_t reg,     ///< [IN] First register to read
+    uint8_t length,  ///< [IN] Number of consecutive registers to read
+    uint8_t *data    ///< [OUT] Values of the registers
 )
 {
-    return !gpioExpander_IsOutput(expander, pin);
+    const gpioExpander_Identifier_t *expander = reader->expander;
+    if (reader->handlePtr == NULL)
+    {
+        const uint32_t startTransactionCount = I2cTransactionCount;
+        const le_result_t result =
+            SmbusReadBlock(expander->i2cBus, expander->i2cAddr, reg, length, data);
+        reader->transactions += I2cTransactionCount - startTransactionCount;
+        return result;
+    }
+
+    int readResult = -1;
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        if (*reader->handlePtr == LE_FAULT)
+        {
+            *reader->handlePtr = I2cTransport->open(expander->i2cBus, expander->i2cAddr);
+            if (*reader->handlePtr == LE_FAULT)
+            {
+                return LE_FAULT;
+            }
+        }
+
+        reader->transactions++;
+        readResult = I2cTransport->readBlockData(*reader->handlePtr, reg, length, data);
+        if (readResult >= 0 || !I2cIsStaleHandleError(errno))
+        {
+            break;
+        }
+        I2cTransport->close(*reader->handlePtr);
+        *reader->handlePtr = LE_FAULT;
+    }
+
+    return (readResult == length) ? LE_OK : LE_FAULT;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Gets the polarity setting of the given GPIO
+ * Writes consecutive registers for the interrupt service.  See Sx1509ReaderReadBlock().
  *
  * @return
- *      The polarity of the specified GPIO
+ *      - LE_OK
+ *      - LE_FAULT
  */
 //--------------------------------------------------------------------------------------------------
-gpioExpander_Polarity_t gpioExpander_GetPolarity
+static le_result_t Sx1509ReaderWriteBlock
 (
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin
+    Sx1509EventReader_t *reader,
+    uint8_t reg,         ///< [IN] First register to write
+    uint8_t length,      ///< [IN] Number of consecutive registers to write
+    const uint8_t *data  ///< [IN] Data to write to the registers
 )
 {
-    const uint8_t polarityFieldWidth = 1;
-    Sx1509_Polarity_t polarity = 0;
-    const le_result_t r = Sx1509ReadPinField(
-        expander,
-        pin,
-        SX1509_REG_POLARITY_A,
-        polarityFieldWidth,
-        (uint8_t *)&polarity);
+    const gpioExpander_Identifier_t *expander = reader->expander;
+    if (reader->handlePtr == NULL)
+    {
+        const uint32_t startTransactionCount = I2cTransactionCount;
+        const le_result_t result =
+            SmbusWriteBlock(expander->i2cBus, expander->i2cAddr, reg, length, data);
+        reader->transactions += I2cTransactionCount - startTransactionCount;
+        return result;
+    }
 
-    // TODO: There is no way to signal failure in the le_gpio.api
-    LE_FATAL_IF (r != LE_OK, "Failed to get GPIO polarity")
+    int writeResult = -1;
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        if (*reader->handlePtr == LE_FAULT)
+        {
+            *reader->handlePtr = I2cTransport->open(expander->i2cBus, expander->i2cAddr);
+            if (*reader->handlePtr == LE_FAULT)
+            {
+                return LE_FAULT;
+            }
+        }
 
-    return (polarity == SX1509_POLARITY_NORMAL) ?
-        GPIO_EXPANDER_ACTIVE_HIGH :
-        GPIO_EXPANDER_ACTIVE_LOW;
+        reader->transactions++;
+        writeResult = I2cTransport->writeBlockData(*reader->handlePtr, reg, length, data);
+        if (writeResult >= 0 || !I2cIsStaleHandleError(errno))
+        {
+            break;
+        }
+        I2cTransport->close(*reader->handlePtr);
+        *reader->handlePtr = LE_FAULT;
+    }
+
+    return (writeResult >= 0) ? LE_OK : LE_FAULT;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Checks if the given GPIO is active or inactive
- *
- * @return
- *      true if the given GPIO is active or false otherwise
+ * Reads and clears the events of an expander without calling any handler, so that it may run in
+ * an interrupt thread.
  *
- * @note
- *      No check is performed to ensure that the GPIO is an output
+ * The upstream interrupt is edge triggered, so an event latched while the previous ones are
+ * serviced raises no new interrupt.  The status is read again after every pass, which is the same
+ * as checking the interrupt line, until nothing is latched.  DATA is read after the events of a
+ * pass are cleared, see Sx1509DispatchEvents().
  */
 //--------------------------------------------------------------------------------------------------
-bool gpioExpander_IsActive
+static void Sx1509CaptureEvents
 (
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin
+    Sx1509EventReader_t *reader,
+    bool readKeys,                    ///< [IN] true if the keypad engine is on
+    bool readStatus,                  ///< [IN] false if no GPIO can raise an interrupt
+    uint64_t timestampUs,             ///< [IN] When the interrupt was raised
+    Sx1509InterruptSample_t *sample   ///< [OUT] What was read
 )
 {
-    return gpioExpander_Read(expander, pin);
+    const gpioExpander_Identifier_t *expander = reader->expander;
+    sample->valid = false;
+    sample->numPasses = 0;
+    sample->dataValidMask = 0;
+    sample->overrunStatus = 0;
+    sample->keyData[0] = 0xFF;
+    sample->keyData[1] = 0xFF;
+    sample->timestampUs = timestampUs;
+
+    // A key press sets no event status.  KEY_DATA_1 and KEY_DATA_2 are read with a single transfer,
+    // which also releases the interrupt of the keypad engine.
+    if (readKeys &&
+        Sx1509ReaderReadBlock(
+            reader, SX1509_REG_KEY_DATA_1, sizeof(sample->keyData), sample->keyData) != LE_OK)
+    {
+        LE_ERROR(
+            "Couldn't read key data of GPIO expander on I2C bus %d at address 0x%x",
+            expander->i2cBus,
+            expander->i2cAddr);
+    }
+
+    // Determine which GPIOs of the expander have generated interrupts
+    uint16_t status = 0;
+    if (readStatus && Sx1509ReadEventStatus(reader, &status) != LE_OK)
+    {
+        sample->transactions = reader->transactions;
+        return;
+    }
+    sample->valid = true;
+
+    while (status != 0)
+    {
+        if (sample->numPasses == SX1509_MAX_SERVICE_PASSES)
+        {
+            // Release the line.  The events are lost but counted.
+            sample->overrunStatus = status;
+            Sx1509ClearEventStatus(reader, status);
+            break;
+        }
+
+        // The events are still latched if they couldn't be cleared, so they are reported once and
+        // the status isn't read again, since it would only return the same events
+        const bool cleared = (Sx1509ClearEventStatus(reader, status) == LE_OK);
+        if (!cleared)
+        {
+            LE_ERROR(
+                "Couldn't clear events 0x%04x of GPIO expander on I2C bus %d at address 0x%x",
+                status,
+                expander->i2cBus,
+                expander->i2cAddr);
+        }
+
+        // Read the current input value of the GPIOs
+        uint8_t data[2];
+        const uint8_t pass = sample->numPasses++;
+        sample->status[pass] = status;
+        sample->data[pass] = 0;
+        if (Sx1509ReaderReadBlock(reader, SX1509_REG_DATA_B, sizeof(data), data) == LE_OK)
+        {
+            sample->data[pass] = ((data[0] << 8) | data[1]);
+            sample->dataValidMask |= (1 << pass);
+        }
+        else
+        {
+            // TODO: What should we do if the read fails?
+            LE_ERROR("Fault while reading GPIO port");
+        }
+
+        if (!cleared || Sx1509ReadEventStatus(reader, &status) != LE_OK)
+        {
+            break;
+        }
+    }
+
+    sample->transactions = reader->transactions;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Gets the resistor settings of the given GPIO
- *
- * @return
- *      The resistor settings of the given GPIO
+ * Calls the handlers for what was read by Sx1509CaptureEvents() and updates the statistics of the
+ * expander.  Runs in the main thread.
  */
 //--------------------------------------------------------------------------------------------------
-gpioExpander_PullUpDown_t gpioExpander_GetPullUpDown
+static void Sx1509DispatchSample
 (
     const gpioExpander_Identifier_t *expander,
-    uint8_t pin
+    Sx1509State_t *state,
+    const gpioExpander_HandlerRecord_t *handlers,
+    const Sx1509InterruptSample_t *sample
 )
 {
-    const uint8_t pullFieldWidth = 1;
-    uint8_t pullUpEnabled;
-    uint8_t pullDownEnabled;
-    const le_result_t pullUpResult = Sx1509ReadPinField(
-        expander,
-        pin,
-        SX1509_REG_PULL_UP_A,
-        pullFieldWidth,
-        &pullUpEnabled);
-    const le_result_t pullDownResult = Sx1509ReadPinField(
-        expander,
-        pin,
-        SX1509_REG_PULL_DOWN_A,
-        pullFieldWidth,
-        &pullDownEnabled);
-
-    // TODO: There is no way to signal failure using le_gpio.api
-    LE_FATAL_IF(
-        (pullUpResult != LE_OK || pullDownResult != LE_OK),
-        "Failed while checking pullup/pulldown settings");
-
-    if (pullUpEnabled == 0 && pullDownEnabled == 0)
+    if (!sample->valid)
     {
-        return GPIO_EXPANDER_PULL_OFF;
+        return;
     }
-    else if (pullUpEnabled == 1 && pullDownEnabled == 0)
+
+    for (uint8_t pass = 0; pass < sample->numPasses; pass++)
     {
-        return GPIO_EXPANDER_PULL_UP;
+        if ((sample->dataValidMask & (1 << pass)) != 0)
+        {
+            StatePageUpdate(expander, sample->data[pass], 0xFFFF);
+        }
+        Sx1509DispatchEvents(
+            expander, state, handlers, sample->status[pass], sample->data[pass], sample->timestampUs);
     }
-    else if (pullUpEnabled == 0 && pullDownEnabled == 1)
+
+    if (sample->overrunStatus != 0)
     {
-        return GPIO_EXPANDER_PULL_DOWN;
+        LE_WARN(
+            "GPIO expander on I2C bus %d at address 0x%x still has events 0x%04x after %d passes",
+            expander->i2cBus,
+            expander->i2cAddr,
+            sample->overrunStatus,
+            SX1509_MAX_SERVICE_PASSES);
+        state->interruptStats.overrunEdges += __builtin_popcount(sample->overrunStatus);
     }
-    else
+
+    state->interruptStats.interrupts++;
+    state->interruptStats.lastTransactions = sample->transactions;
+    state->interruptStats.transactions += sample->transactions;
+    LE_DEBUG(
+        "Serviced interrupt of GPIO expander on I2C bus %d at address 0x%x with %u I2C transactions",
+        expander->i2cBus,
+        expander->i2cAddr,
+        sample->transactions);
+
+    // Report the key press, if any.  The key data is active low.
+    int row;
+    int column;
+    Sx1509DecodeKey(sample->keyData, &row, &column);
+    if (state->keyHandlerPtr != NULL && row >= 0 && column >= 0)
     {
-        // TODO: There is no way to signal failure using le_gpio.api
-        LE_FATAL("Pullup and pulldown are enabled simultaneously");
+        state->keyHandlerPtr(row, column, state->keyContextPtr);
     }
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Performs a software reset of the specified SX1509 GPIO expander
- *
- * Upon completion, the SX1509 will be in a state equivalent to if the POR pin had been asserted.
+ * Main function of an interrupt thread.  Opens the I2C handles of the thread and lets the board
+ * configuration register the handler of the interrupt line, which is then called by the event loop
+ * of the thread.
  */
 //--------------------------------------------------------------------------------------------------
-void gpioExpander_Reset
+static void *Sx1509InterruptThreadMain
 (
-    const gpioExpander_Identifier_t *expander  ///< I2C identifier for the GPIO expander
+    void *contextPtr  ///< [IN] The interrupt thread
 )
 {
-    const uint8_t magicResetVals[] = { 0x12, 0x34 };
-    for (int i = 0; i < NUM_ARRAY_MEMBERS(magicResetVals); i++)
+    struct gpioExpander_InterruptThread *thread = contextPtr;
+    for (uint8_t i = 0; i < thread->numSources; i++)
     {
+        Sx1509InterruptSource_t *source = &thread->sources[i];
+        source->handle = I2cTransport->open(source->expander->i2cBus, source->expander->i2cAddr);
         LE_FATAL_IF(
-            SmbusWriteReg(
-                expander->i2cBus, expander->i2cAddr, SX1509_REG_RESET, magicResetVals[i]) != LE_OK,
-            "Failed to reset GPIO expander on I2C bus %d at address 0x%x",
-            expander->i2cBus,
-            expander->i2cAddr);
+            source->handle == LE_FAULT,
+            "Couldn't open I2C bus %d for the interrupt of GPIO expander at address 0x%x",
+            source->expander->i2cBus,
+            source->expander->i2cAddr);
     }
+
+    thread->bindFunc(thread, thread->bindContextPtr);
+    le_event_RunLoop();
+    return NULL;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * An event handler which is parameterized to handle the interrupts of all GPIO expanders
- *
- * The handler will call the handler for each GPIO which has triggered due to an edge condition.
+ * Passes a sample from an interrupt thread to the main thread.  If the main thread has fallen so
+ * far behind that the queue is full, the events are counted as overrun.
  */
 //--------------------------------------------------------------------------------------------------
-void gpioExpander_GenericInterruptHandler
+static void Sx1509QueueSample
 (
-    const gpioExpander_Identifier_t *expander,
-    const gpioExpander_HandlerRecord_t *handlers
+    struct gpioExpander_InterruptThread *thread,
+    uint8_t source,                         ///< [IN] Index of the expander within the thread
+    const Sx1509InterruptSample_t *sample
 )
 {
-    // Determine which GPIOs of the expander have generated interrupts
-    uint8_t statusA;
-    uint8_t statusB;
-    le_result_t result = SmbusReadReg(
-        expander->i2cBus, expander->i2cAddr, SX1509_REG_EVENT_STATUS_B, &statusB);
-    if (result != LE_OK)
-    {
-        // TODO: What should we do if the read fails?
-    }
-    result = SmbusReadReg(
-        expander->i2cBus, expander->i2cAddr, SX1509_REG_EVENT_STATUS_A, &statusA);
-    if (result != LE_OK)
+    const uint32_t head = thread->queueHead;
+    if (head - __atomic_load_n(&thread->queueTail, __ATOMIC_ACQUIRE) == SX1509_INTERRUPT_QUEUE_SIZE)
     {
-        // TODO: What should we do if the read fails?
+        uint32_t edges = __builtin_popcount(sample->overrunStatus);
+        for (uint8_t pass = 0; pass < sample->numPasses; pass++)
+        {
+            edges += __builtin_popcount(sample->status[pass]);
+        }
+        __atomic_add_fetch(&thread->sources[source].droppedEdges, edges, __ATOMIC_RELAXED);
+        return;
     }
-    const uint16_t status = ((statusB << 8) | statusA);
 
-    // Clear the interrupt status for all GPIOs on the expander
-    result = SmbusWriteReg(
-        expander->i2cBus,
-        expander->i2cAddr,
-        SX1509_REG_EVENT_STATUS_B,
-        statusB);
-    if (result != LE_OK)
+    Sx1509QueuedSample_t *entry = &thread->queue[head & (SX1509_INTERRUPT_QUEUE_SIZE - 1)];
+    entry->source = source;
+    entry->sample = *sample;
+    __atomic_store_n(&thread->queueHead, head + 1, __ATOMIC_RELEASE);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Called in the main thread when an interrupt thread has queued samples.  Calls the handlers for
+ * all queued samples in the order they were queued.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Sx1509InterruptQueueHandler
+(
+    int fd,       ///< [IN] The event fd of the interrupt thread
+    short events  ///< [IN] Unused
+)
+{
+    struct gpioExpander_InterruptThread *thread = le_fdMonitor_GetContextPtr();
+    uint64_t count;
+    if (read(fd, &count, sizeof(count)) < 0 && errno != EAGAIN)
     {
-        // TODO: What should we do if the write fails?
+        LE_ERROR("Couldn't read event fd (%m)");
     }
-    result = SmbusWriteReg(
-        expander->i2cBus,
-        expander->i2cAddr,
-        SX1509_REG_EVENT_STATUS_A,
-        statusA);
-    if (result != LE_OK)
+
+    uint32_t tail = thread->queueTail;
+    while (tail != __atomic_load_n(&thread->queueHead, __ATOMIC_ACQUIRE))
     {
-        // TODO: What should we do if the write fails?
+        // The entry is copied out and released first, so that the interrupt thread can reuse it
+        // while the handlers run
+        const Sx1509QueuedSample_t *entry = &thread->queue[tail & (SX1509_INTERRUPT_QUEUE_SIZE - 1)];
+        const Sx1509InterruptSource_t *source = &thread->sources[entry->source];
+        const Sx1509InterruptSample_t sample = entry->sample;
+        tail++;
+        __atomic_store_n(&thread->queueTail, tail, __ATOMIC_RELEASE);
+
+        Sx1509DispatchSample(source->expander, source->state, source->handlers, &sample);
     }
 
-    // Read the current input value of the GPIOs
-    uint8_t dataB = 0;
-    uint8_t dataA = 0;
-    if (statusB != 0)
+    for (uint8_t i = 0; i < thread->numSources; i++)
     {
-        result = SmbusReadReg(
-            expander->i2cBus, expander->i2cAddr, SX1509_REG_DATA_B, &dataB);
-        if (result != LE_OK)
+        Sx1509InterruptSource_t *source = &thread->sources[i];
+        const uint32_t dropped = __atomic_exchange_n(&source->droppedEdges, 0, __ATOMIC_RELAXED);
+        if (dropped != 0)
         {
-            // TODO: What should we do if the read fails?
+            LE_WARN(
+                "Interrupt queue was full.  Lost %u events of GPIO expander on I2C bus %d at "
+                "address 0x%x",
+                dropped,
+                source->expander->i2cBus,
+                source->expander->i2cAddr);
+            source->state->interruptStats.overrunEdges += dropped;
         }
     }
-    if (statusA != 0)
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Calls the handlers of the GPIOs with events, given DATA as read after the events were cleared.
+ *
+ * DATA is read after the events are cleared, so a GPIO may have changed again in the meantime.
+ * Such changes are recovered using the state last reported for the GPIO:
+ *  - With both edges sensed, an unchanged state means the GPIO toggled and returned.  The
+ *    intermediate state is reported before the current one.
+ *  - With one edge sensed, every event leads to the state of that edge, which is reported
+ *    whatever DATA holds.  The state last reported is not needed, so a wrong one can't stick.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Sx1509DispatchEvents
+(
+    const gpioExpander_Identifier_t *expander,
+    Sx1509State_t *state,
+    const gpioExpander_HandlerRecord_t *handlers,
+    uint16_t status,
+    uint16_t data,
+    uint64_t timestampUs
+)
+{
+    // Cascaded interrupts are serviced by the interrupt thread itself
+    status &= ~state->cascadeMask;
+
+    // Count the events of each GPIO within the current second
+    uint16_t storming = 0;
+    if (state->stormLimit != 0)
     {
-        result = SmbusReadReg(
-            expander->i2cBus, expander->i2cAddr, SX1509_REG_DATA_A, &dataA);
-        if (result != LE_OK)
+        if (timestampUs - state->stormWindowStartUs >= SX1509_STORM_WINDOW_US)
         {
-            // TODO: What should we do if the read fails?
+            state->stormWindowStartUs = timestampUs;
+            memset(state->stormEvents, 0, sizeof(state->stormEvents));
+        }
+        for (uint8_t i = 0; i < 16; i++)
+        {
+            if ((status & (1 << i)) != 0 && ++state->stormEvents[i] > state->stormLimit)
+            {
+                storming |= (1 << i);
+            }
         }
     }
-    const uint16_t data = ((dataB << 8) | dataA);
+
+    // The port handler may be changed by the per GPIO handlers, so it is sampled first
+    const gpioExpander_PortChangeCallbackFunc_t portHandlerPtr = state->portHandlerPtr;
+    void *portContextPtr = state->portContextPtr;
+    const gpioExpander_Edge_t portTrigger = state->portTrigger;
+    uint16_t portStatus = status & state->portHandlerMask;
 
     // Call the registered handlers for each of the interrupts
     for (int i = 0; i <= 15; i++)
     {
-        if (status & (1 << i))
+        if ((status & (1 << i)) == 0)
         {
-            const gpioExpander_HandlerRecord_t *handler = &handlers[i];
-            LE_FATAL_IF(
-                handler->handlerPtr == NULL, "Interrupt has fired, but no handler is registered");
-            const bool gpioActive = ((data >> i) & 1) == 1;
-            (*(handler->handlerPtr))(gpioActive, handler->contextPtr);
+            continue;
         }
-    }
-}
 
-le_result_t gpioExpander_DiscoverPrimaryI2cBusNum
-(
-    uint8_t *busNum  ///< [OUT] Primary I2C bus number
-)
-{
-    const char *prefix = "/dev/i2c-";
-    const uint8_t numsToTry[] = {0, 4};
-    char path[16];
+        // The last handler of a GPIO may have been removed after its event was captured, or by
+        // a handler called in an earlier pass, so the event is no longer wanted
+        const gpioExpander_HandlerRecord_t *handler = &handlers[i];
+        if (le_dls_IsEmpty(&handler->subscribers))
+        {
+            if ((portStatus & (1 << i)) == 0)
+            {
+                LE_DEBUG("Dropped event of GPIO %d which no longer has a handler", i);
+                state->interruptStats.unhandledEvents++;
+            }
+            continue;
+        }
 
-    for (int i = 0; i < NUM_ARRAY_MEMBERS(numsToTry); i++)
-    {
-        struct stat statBuf = {};
-        const int formattedStringLen = snprintf(path, sizeof(path), "%s%d", prefix, numsToTry[i]);
-        LE_ASSERT(formattedStringLen < NUM_ARRAY_MEMBERS(path));
-        if (stat(path, &statBuf) == 0)
+        const bool gpioActive = ((data >> i) & 1) == 1;
+        const bool known = (state->reportedMask & (1 << i)) != 0;
+        const bool lastActive = ((state->reportedValues >> i) & 1) == 1;
+        const gpioExpander_Edge_t sense = Sx1509GetShadowedPinField(expander, i, SX1509_FIELD_SENSE);
+        bool reportActive = gpioActive;
+        bool toggled = false;
+        if (sense == GPIO_EXPANDER_EDGE_RISING || sense == GPIO_EXPANDER_EDGE_FALLING)
         {
-            if (S_ISCHR(statBuf.st_mode))
+            reportActive = (sense == GPIO_EXPANDER_EDGE_RISING);
+            if (reportActive != gpioActive)
             {
-                *busNum = numsToTry[i];
-                return LE_OK;
+                state->interruptStats.recoveredEdges++;
             }
         }
+        else if (known && sense == GPIO_EXPANDER_EDGE_BOTH && lastActive == gpioActive)
+        {
+            toggled = true;
+            state->interruptStats.recoveredEdges++;
+            Sx1509CallChangeHandler(handler, sense, !gpioActive, timestampUs);
+        }
+
+        // The GPIO may sense both edges for its own handlers while the port handler wants one
+        if (!toggled && portTrigger != GPIO_EXPANDER_EDGE_BOTH &&
+            reportActive != (portTrigger == GPIO_EXPANDER_EDGE_RISING))
+        {
+            portStatus &= ~(1 << i);
+        }
+
+        state->reportedMask |= (1 << i);
+        state->reportedValues = (state->reportedValues & ~(1 << i)) | (reportActive << i);
+        Sx1509CallChangeHandler(handler, sense, reportActive, timestampUs);
     }
 
-    return LE_NOT_FOUND;
+    // All GPIOs watched by the port handler are reported with one call
+    if (portHandlerPtr != NULL && portStatus != 0)
+    {
+        portHandlerPtr(portStatus, data, timestampUs, portContextPtr);
+    }
+
+    // The events which exceeded the limit have been reported, but no further ones will be until
+    // the GPIO calms down.  Handlers may have been removed in the meantime.
+    storming &= (state->pinHandlerMask | state->portHandlerMask) & ~state->stormMask;
+    for (uint8_t i = 0; i < 16; i++)
+    {
+        if ((storming & (1 << i)) != 0)
+        {
+            Sx1509ThrottlePin(expander, state, handlers, i, data, timestampUs);
+        }
+    }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Throttles a GPIO which has exceeded the limit of events.  Its interrupt is masked and its edge
+ * sense turned off, so that it neither raises interrupts nor latches events which would keep the
+ * other GPIOs of the expander busy, and it is polled at a low rate instead.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Sx1509ThrottlePin
+(
+    const gpioExpander_Identifier_t *expander,
+    Sx1509State_t *state,
+    const gpioExpander_HandlerRecord_t *handlers,
+    uint8_t pin,
+    uint16_t data,         ///< [IN] GPIOs as read by the last pass
+    uint64_t timestampUs   ///< [IN] Time of the event which exceeded the limit
+)
+{
+    const uint16_t bit = (1 << pin);
+    const gpioExpander_Edge_t sense = Sx1509GetShadowedPinField(expander, pin, SX1509_FIELD_SENSE);
 
-//-------------------------------------------------------------------------------------------------
-// Static functions
-//-------------------------------------------------------------------------------------------------
+    Sx1509Batch_t batch;
+    Sx1509BatchInit(&batch, expander);
+    if (Sx1509BatchAddPinField(&batch, pin, SX1509_FIELD_INTERRUPT_MASK, 1) != LE_OK ||
+        Sx1509BatchAddPinField(&batch, pin, SX1509_FIELD_SENSE, GPIO_EXPANDER_EDGE_NONE) != LE_OK ||
+        Sx1509BatchCommit(&batch) != LE_OK)
+    {
+        LE_ERROR(
+            "Couldn't throttle GPIO %d of GPIO expander on I2C bus %d at address 0x%x",
+            pin,
+            expander->i2cBus,
+            expander->i2cAddr);
+        return;
+    }
+
+    state->stormMask |= bit;
+    state->stormSense[pin] = sense;
+    state->stormQuietSinceUs[pin] = timestampUs;
+    state->interruptStats.throttles++;
+    LE_WARN(
+        "GPIO %d of GPIO expander on I2C bus %d at address 0x%x exceeded %u events/s.  Polling it "
+        "every %d ms until it calms down.",
+        pin,
+        expander->i2cBus,
+        expander->i2cAddr,
+        state->stormLimit,
+        SX1509_STORM_POLL_MS);
+
+    // Polling continues from the state last reported, so that the next change reported is a real
+    // one
+    const bool pinHandled = (state->pinHandlerMask & bit) != 0;
+    const uint16_t values = pinHandled ? state->reportedValues : data;
+    const bool rising = (sense == GPIO_EXPANDER_EDGE_RISING || sense == GPIO_EXPANDER_EDGE_BOTH);
+    const bool falling = (sense == GPIO_EXPANDER_EDGE_FALLING || sense == GPIO_EXPANDER_EDGE_BOTH);
+    state->pollRecords[pin] = pinHandled ? &handlers[pin] : NULL;
+    state->pollSampleMs[pin] = SX1509_STORM_POLL_MS;
+    state->pollRisingMask = (state->pollRisingMask & ~bit) | (rising << pin);
+    state->pollFallingMask = (state->pollFallingMask & ~bit) | (falling << pin);
+    state->pollValues = (state->pollValues & ~bit) | (values & bit);
+    state->pollMask |= bit;
+    Sx1509StartPoll(expander, state);
+}
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Get the file handle for the given I2C bus and configure it for access to the given I2C address.
- *
- * @return
- *      - LE_FAULT on failure
- *      - A filehandle to the I2C bus
+ * Hands a throttled GPIO back to the interrupt.  Its edge sense is restored and its interrupt is
+ * unmasked if it is still watched.
  */
 //--------------------------------------------------------------------------------------------------
-static int I2cAccessBusAddr
+static void Sx1509UnthrottlePin
 (
-    uint8_t i2cBus,
-    uint8_t i2cAddr
+    const gpioExpander_Identifier_t *expander,
+    Sx1509State_t *state,
+    uint8_t pin
 )
 {
-    const size_t filenameSize = 32;
-    char filename[filenameSize];
+    const uint16_t bit = (1 << pin);
+    const bool watched = ((state->pinHandlerMask | state->portHandlerMask) & bit) != 0;
+    state->stormMask &= ~bit;
+    Sx1509StopPoll(state, pin);
 
-    snprintf(filename, filenameSize, "/dev/i2c/%d", i2cBus);
+    Sx1509Batch_t batch;
+    Sx1509BatchInit(&batch, expander);
+    if (Sx1509BatchAddPinField(&batch, pin, SX1509_FIELD_SENSE, state->stormSense[pin]) != LE_OK ||
+        Sx1509BatchAddPinField(&batch, pin, SX1509_FIELD_INTERRUPT_MASK, watched ? 0 : 1) != LE_OK ||
+        Sx1509BatchCommit(&batch) != LE_OK)
+    {
+        LE_ERROR(
+            "Couldn't restore the interrupt of GPIO %d of GPIO expander on I2C bus %d at address "
+            "0x%x",
+            pin,
+            expander->i2cBus,
+            expander->i2cAddr);
+        return;
+    }
 
-    LE_DEBUG("Opening I2C bus: '%s'", filename);
-    int fd = open(filename, O_RDWR);
-    if (fd < 0 && (errno == ENOENT || errno == ENOTDIR))
+    // The next event is checked against the state last polled
+    state->reportedValues = (state->reportedValues & ~bit) | (state->pollValues & bit);
+    state->reportedMask |= bit;
+    state->stormEvents[pin] = 0;
+    if (watched)
     {
-        snprintf(filename, filenameSize, "/dev/i2c-%d", i2cBus);
-        LE_DEBUG("Opening I2C bus: '%s'", filename);
-        fd = open(filename, O_RDWR);
+        LE_INFO(
+            "GPIO %d of GPIO expander on I2C bus %d at address 0x%x has calmed down",
+            pin,
+            expander->i2cBus,
+            expander->i2cAddr);
     }
+}
 
-    if (fd < 0)
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gathers the edges requested by the per GPIO handlers of a GPIO and applies them, see
+ * Sx1509ApplyWatch().
+ */
+//--------------------------------------------------------------------------------------------------
+static void Sx1509ApplySubscribers
+(
+    const gpioExpander_Identifier_t *expander,
+    Sx1509State_t *state,
+    uint8_t pin,
+    gpioExpander_HandlerRecord_t *handlerRecord
+)
+{
+    bool rising = false;
+    bool falling = false;
+    uint32_t sampleMs = UINT32_MAX;
+    for (le_dls_Link_t *linkPtr = le_dls_Peek(&handlerRecord->subscribers);
+         linkPtr != NULL;
+         linkPtr = le_dls_PeekNext(&handlerRecord->subscribers, linkPtr))
     {
-        if (errno == ENOENT)
-        {
-            LE_ERROR(
-                "Could not open file /dev/i2c-%d or /dev/i2c/%d: %s\n",
-                i2cBus,
-                i2cBus,
-                strerror(ENOENT));
-        }
-        else
+        const Sx1509Subscriber_t *subscriber = CONTAINER_OF(linkPtr, Sx1509Subscriber_t, link);
+        rising |= (subscriber->edge == GPIO_EXPANDER_EDGE_RISING ||
+                   subscriber->edge == GPIO_EXPANDER_EDGE_BOTH);
+        falling |= (subscriber->edge == GPIO_EXPANDER_EDGE_FALLING ||
+                    subscriber->edge == GPIO_EXPANDER_EDGE_BOTH);
+        if (subscriber->sampleMs < sampleMs)
         {
-            LE_ERROR("Could not open file %s': %s\n", filename, strerror(errno));
+            sampleMs = subscriber->sampleMs;
         }
-
-        return LE_FAULT;
     }
-
-    if (ioctl(fd, I2C_SLAVE_FORCE, i2cAddr) < 0)
+    state->pinSense[pin] = (rising ? GPIO_EXPANDER_EDGE_RISING : 0) |
+                           (falling ? GPIO_EXPANDER_EDGE_FALLING : 0);
+    state->pollRecords[pin] = handlerRecord;
+    if ((state->stormMask & (1 << pin)) == 0)
     {
-        LE_ERROR("Could not set address to 0x%02x: %s\n", i2cAddr, strerror(errno));
-        return LE_FAULT;
+        state->pollSampleMs[pin] = sampleMs;
     }
 
-    return fd;
+    // TODO: We need to find a better way to deal with the unlikely event of a failure.  The
+    // function can't return anything except an opaque reference, so we have no way of signalling
+    // failure to the client.
+    Sx1509Batch_t batch;
+    Sx1509BatchInit(&batch, expander);
+    LE_FATAL_IF(
+        Sx1509ApplyWatch(expander, state, pin, &batch) != LE_OK ||
+            Sx1509BatchCommit(&batch) != LE_OK,
+        "Failed to set edge sense during event handler registration");
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Performs an SMBUS read of a 1 byte register
- *
- * @return
- *      - LE_OK
- *      - LE_FAULT
+ * Gets the edges which a GPIO must sense: those requested by its per GPIO change handlers and, if
+ * the port handler watches it, those of the port handler.
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t SmbusReadReg
+static gpioExpander_Edge_t Sx1509GetWatchedSense
 (
-    uint8_t i2cBus,  ///< [IN] I2C bus to perform the read on
-    uint8_t i2cAddr, ///< [IN] I2C address to read from
-    uint8_t reg,     ///< [IN] Register within the I2C device to read
-    uint8_t *data    ///< [OUT] Value stored within the register.  This value is only valid if the
-                     ///  function returned LE_OK.
+    const Sx1509State_t *state,
+    uint8_t pin
 )
 {
-    int i2cFd = I2cAccessBusAddr(i2cBus, i2cAddr);
-    if (i2cFd == LE_FAULT) {
-        LE_ERROR("failed to open i2c bus %d for access to address %d\n", i2cBus, i2cAddr);
-        return  LE_FAULT;
-    }
-
-    le_result_t result;
-    const int readResult = i2c_smbus_read_byte_data(i2cFd, reg);
-    if (readResult < 0)
-    {
-        LE_ERROR("smbus read failed with error %d", readResult);
-        result = LE_FAULT;
-    }
-    else
+    uint8_t sense = state->pinSense[pin];
+    if ((state->portHandlerMask & (1 << pin)) != 0)
     {
-        *data = readResult;
-        result = LE_OK;
+        sense |= state->portTrigger;
     }
-    close(i2cFd);
-
-    LE_DEBUG("SMBUS READ addr=0x%x, reg=0x%x, data=0x%x", i2cAddr, reg, *data);
-
-    return result;
+    return (gpioExpander_Edge_t)sense;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Performs an SMBUS write of a 1 byte register
+ * Applies the edges a GPIO must sense, see Sx1509GetWatchedSense(), after its handlers have
+ * changed.  This is the only place which decides how a watched GPIO is serviced:
+ *  - With a bound interrupt, the edges are sensed and the interrupt is unmasked.
+ *  - Without one, the edges are sensed but the interrupt stays masked so that the expander doesn't
+ *    hold a shared interrupt line which nobody clears, and the GPIO is polled instead.
+ *  - A throttled GPIO keeps being polled at the period of throttling and takes on the edges when
+ *    it is handed back to the interrupt.
+ *  - A GPIO which is no longer watched stops sensing edges, as EVENT_STATUS latches on SENSE
+ *    whatever the mask says and its events would otherwise be reported along with the next
+ *    interrupt of another GPIO, and its interrupt is masked.
+ *
+ * Cascaded GPIOs are left alone.  The register writes are added to the batch, which the caller
+ * commits.
  *
  * @return
  *      - LE_OK
  *      - LE_FAULT
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t SmbusWriteReg
+static le_result_t Sx1509ApplyWatch
 (
-    uint8_t i2cBus,  ///< [IN] I2C bus to perform the write on
-    uint8_t i2cAddr, ///< [IN] Address of the I2C device to write
-    uint8_t reg,     ///< [IN] Register within the I2C device to write
-    uint8_t data     ///< [IN] Data to write to the given register
+    const gpioExpander_Identifier_t *expander,
+    Sx1509State_t *state,
+    uint8_t pin,
+    Sx1509Batch_t *batch
 )
 {
-    int i2cFd = I2cAccessBusAddr(i2cBus, i2cAddr);
-    if (i2cFd == LE_FAULT) {
-        LE_ERROR("failed to open i2c bus %d for access to address %d\n", i2cBus, i2cAddr);
-        return LE_FAULT;
+    const uint16_t bit = (1 << pin);
+    if ((state->cascadeMask & bit) != 0)
+    {
+        return LE_OK;
     }
 
-    le_result_t result;
-    const int writeResult = i2c_smbus_write_byte_data(i2cFd, reg, data);
-    if (writeResult < 0)
+    const gpioExpander_Edge_t sense = Sx1509GetWatchedSense(state, pin);
+    const bool rising = (sense & GPIO_EXPANDER_EDGE_RISING) != 0;
+    const bool falling = (sense & GPIO_EXPANDER_EDGE_FALLING) != 0;
+
+    // A throttled GPIO which is no longer watched is simply released, as it already neither
+    // senses edges nor raises interrupts
+    bool throttled = (state->stormMask & bit) != 0;
+    if (throttled && sense == GPIO_EXPANDER_EDGE_NONE)
     {
-        LE_ERROR("smbus write failed with error %d", writeResult);
-        result = LE_FAULT;
+        state->stormMask &= ~bit;
+        state->stormEvents[pin] = 0;
+        throttled = false;
     }
-    else
+
+    const bool polled = (sense != GPIO_EXPANDER_EDGE_NONE) && (!state->interruptBound || throttled);
+    if (polled)
+    {
+        if (throttled)
+        {
+            state->pollSampleMs[pin] = SX1509_STORM_POLL_MS;
+        }
+        else if ((state->pinHandlerMask & bit) == 0)
+        {
+            state->pollSampleMs[pin] = SX1509_POLL_DEFAULT_MS;
+        }
+        state->pollRisingMask = (state->pollRisingMask & ~bit) | (rising << pin);
+        state->pollFallingMask = (state->pollFallingMask & ~bit) | (falling << pin);
+
+        // The GPIO starts from its current value so that no change is reported at once
+        uint16_t values;
+        if ((state->pollMask & bit) == 0 && gpioExpander_ReadPort(expander, &values) == LE_OK)
+        {
+            state->pollValues = (state->pollValues & ~bit) | (values & bit);
+        }
+        state->pollMask |= bit;
+        Sx1509StartPoll(expander, state);
+    }
+    else if ((state->pollMask & bit) != 0)
     {
-        result = LE_OK;
+        Sx1509StopPoll(state, pin);
     }
-    close(i2cFd);
 
-    LE_DEBUG("SMBUS WRITE addr=0x%x, reg=0x%x, data=0x%x", i2cAddr, reg, data);
+    if (throttled)
+    {
+        state->stormSense[pin] = sense;
+        return LE_OK;
+    }
 
-    return result;
+    // The state reported for the new edge(s) is learnt again from the next event
+    if (Sx1509GetShadowedPinField(expander, pin, SX1509_FIELD_SENSE) != sense)
+    {
+        state->reportedMask &= ~bit;
+    }
+    const bool unmasked = (sense != GPIO_EXPANDER_EDGE_NONE) && state->interruptBound;
+    if (Sx1509BatchAddPinField(batch, pin, SX1509_FIELD_SENSE, sense) != LE_OK ||
+        Sx1509BatchAddPinField(batch, pin, SX1509_FIELD_INTERRUPT_MASK, unmasked ? 0 : 1) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Performs a masked SMBUS write of a 1 byte register
+ * Applies the edges each GPIO of a mask must sense after the port handler has changed, as one
+ * combined transfer
  *
  * @return
  *      - LE_OK
  *      - LE_FAULT
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t SmbusReadModifyWrite
+static le_result_t Sx1509ApplyPortWatch
 (
-    uint8_t i2cBus,    ///< [IN] I2C bus to perform the masked write on
-    uint8_t i2cAddr,   ///< [IN] Address of the I2C device to perform the masked write on
-    uint8_t reg,       ///< [IN] Register within the I2C device to perform the masked write on
-    uint8_t writeData, ///< [IN] Value to write into the register
-    uint8_t writeMask  ///< [IN] Mask to apply to write.  Only bits which are set in the mask will
-                       ///  be written from the writeData parameter into the given register.
+    const gpioExpander_Identifier_t *expander,
+    Sx1509State_t *state,
+    uint16_t mask
 )
 {
-    uint8_t data;
-    le_result_t r = SmbusReadReg(i2cBus, i2cAddr, reg, &data);
-    if (r != LE_OK)
-    {
-        LE_ERROR("Failed during read portion of SMBUS read-modify-write");
-        return LE_FAULT;
-    }
-
-    data = (data & ~writeMask) | (writeData & writeMask);
-
-    r = SmbusWriteReg(i2cBus, i2cAddr, reg, data);
-    if (r != LE_OK)
+    Sx1509Batch_t batch;
+    Sx1509BatchInit(&batch, expander);
+    for (uint8_t pin = 0; pin < 16; pin++)
     {
-        LE_ERROR("Failed during write portion of SMBUS read-modify-write");
-        return LE_FAULT;
+        if ((mask & (1 << pin)) != 0 && Sx1509ApplyWatch(expander, state, pin, &batch) != LE_OK)
+        {
+            return LE_FAULT;
+        }
     }
 
-    return LE_OK;
+    return Sx1509BatchCommit(&batch);
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Computes access offsets for a register which has pin fields inside it
+ * Calls the handlers of a GPIO which requested the change.  A handler which requested the edges
+ * sensed is called for every change.  Otherwise a handler of rising edges is called when the GPIO
+ * becomes active and a handler of falling edges when it becomes inactive.
  *
- * In the SX1509 GPIO expander, there are 16 pins and fields are either 1 or 2 bits wide.  For 1
- * bit wide fields, 2 8-bit registers are required to accomodate all 16 GPIOs.  For 2 bit wide
- * fields, 4 8-bit registers are required.  The registers are arranged consistently such that
- * Register N contains the field for GPIO 15 in it's most significant bit (or 2 bits if it is a 2
- * bit wide field).  This is followed by the field for GPIO 14 and so on.  This function gets the
- * register address and bit offset of a target field based upon the register address which contains
- * the field for pin 0 and the width of each field.
+ * A handler may remove itself, but not the other handlers of the same GPIO.
  */
 //--------------------------------------------------------------------------------------------------
-static void Sx1509ComputePinFieldAccessParameters(
-    uint8_t baseReg,      ///< [IN] Register which contains the field for GPIO 0
-    uint8_t pinNum,       ///< [IN] Pin number of the field that the client wishes to access
-    uint8_t fieldWidth,   ///< [IN] Field width.  Should be 1 or 2.
-    uint8_t *reg,         ///< [OUT] Register which contains the field of interest
-    uint8_t *offsetInReg  ///< [OUT] Bit offset of the field within the reg output parameter
+static void Sx1509CallChangeHandler
+(
+    const gpioExpander_HandlerRecord_t *handler,
+    gpioExpander_Edge_t sense,  ///< [IN] Edges sensed for the GPIO
+    bool active,                ///< [IN] State of the GPIO after the change
+    uint64_t timestampUs        ///< [IN] Time of the change
 )
 {
-    // TODO: should we check that pinNum is in range 0..15 or that fieldWidth is 1 or 2?
-    const uint8_t totalOffset = pinNum * fieldWidth;
-    const uint8_t regOffset = totalOffset / 8;
-    *reg = baseReg - regOffset;
-    *offsetInReg = totalOffset % 8;
+    le_dls_Link_t *linkPtr = le_dls_Peek(&handler->subscribers);
+    while (linkPtr != NULL)
+    {
+        const Sx1509Subscriber_t *subscriber = CONTAINER_OF(linkPtr, Sx1509Subscriber_t, link);
+        linkPtr = le_dls_PeekNext(&handler->subscribers, linkPtr);
+
+        if (subscriber->edge != sense && subscriber->edge != GPIO_EXPANDER_EDGE_BOTH &&
+            !(subscriber->edge == GPIO_EXPANDER_EDGE_RISING && active) &&
+            !(subscriber->edge == GPIO_EXPANDER_EDGE_FALLING && !active))
+        {
+            continue;
+        }
+
+        if (subscriber->timedHandlerPtr != NULL)
+        {
+            subscriber->timedHandlerPtr(active, timestampUs, subscriber->contextPtr);
+        }
+        else
+        {
+            subscriber->handlerPtr(active, subscriber->contextPtr);
+        }
+    }
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Create a mask of a fixed width
- *
- * @return
- *      A mask with the least width significant bits set
- *
- * @note
- *      It is invalid to specify a width > 8, but the width is not validated by this function
+ * Starts polling, or restarts it at the shortest requested period after a GPIO has been added
  */
 //--------------------------------------------------------------------------------------------------
-static uint8_t CreateMask(
-    uint8_t width  ///< [IN] Width int bits of the mask to create
+static void Sx1509StartPoll
+(
+    const gpioExpander_Identifier_t *expander,
+    Sx1509State_t *state
 )
 {
-    return (1 << width) - 1;
+    if (state->pollTimer == NULL)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "gpioExpPoll%d-%02x", expander->i2cBus, expander->i2cAddr);
+        state->pollTimer = le_timer_Create(name);
+        le_timer_SetHandler(state->pollTimer, &Sx1509PollTimerHandler);
+        le_timer_SetContextPtr(state->pollTimer, state);
+        le_timer_SetRepeat(state->pollTimer, 1);
+    }
+
+    uint32_t baseMs = UINT32_MAX;
+    for (uint8_t pin = 0; pin < 16; pin++)
+    {
+        if ((state->pollMask & (1 << pin)) != 0 && state->pollSampleMs[pin] < baseMs)
+        {
+            baseMs = state->pollSampleMs[pin];
+        }
+    }
+    state->pollBaseMs = (baseMs > SX1509_POLL_MIN_PERIOD_MS) ? baseMs : SX1509_POLL_MIN_PERIOD_MS;
+    state->pollPeriodMs = state->pollBaseMs;
+    state->pollIdleSamples = 0;
+
+    le_timer_Stop(state->pollTimer);
+    le_timer_SetMsInterval(state->pollTimer, state->pollPeriodMs);
+    le_timer_Start(state->pollTimer);
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Extract a bit-field from a uint8_t
- *
- * @return
- *      The bit-field value
- *
- * @note
- *      No validation of the width or offset is performed
+ * Stops polling a GPIO, and the expander once no GPIO is left
  */
 //--------------------------------------------------------------------------------------------------
-static uint8_t ExtractField(
-    uint8_t data,   ///< [IN] value to extract the bit-field from
-    uint8_t offset, ///< [IN] bit offset of the field within the data
-    uint8_t width   ///< [IN] width of the bit-field
+static void Sx1509StopPoll
+(
+    Sx1509State_t *state,
+    uint8_t pin
 )
 {
-    return (data >> offset) & CreateMask(width);
+    state->pollMask &= ~(1 << pin);
+    state->pollRisingMask &= ~(1 << pin);
+    state->pollFallingMask &= ~(1 << pin);
+    state->pollRecords[pin] = NULL;
+    if (state->pollMask == 0 && state->pollTimer != NULL)
+    {
+        le_timer_Stop(state->pollTimer);
+    }
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Reads the field associated with a single pin from a register
- *
- * @return
- *      - LE_OK
- *      - LE_FAULT
+ * Samples the polled GPIOs of an expander and reports the changes which match the edges requested
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t Sx1509ReadPinField(
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin,
-    uint8_t baseReg,                       ///< [IN] Register containing the field for pin 0
-    uint8_t fieldWidth,                    ///< [IN] Width of the field in bits
-    uint8_t *fieldData                     ///< [OUT] The extracted field data shifted into the
-                                           ///  least significant bit(s).
+static void Sx1509PollTimerHandler
+(
+    le_timer_Ref_t timer
 )
 {
-    uint8_t reg;
-    uint8_t fieldOffset;
-    Sx1509ComputePinFieldAccessParameters(baseReg, pin, fieldWidth, &reg, &fieldOffset);
+    Sx1509State_t *state = le_timer_GetContextPtr(timer);
+    const gpioExpander_Identifier_t expander =
+    {
+        .i2cBus  = state->i2cBus,
+        .i2cAddr = state->i2cAddr,
+    };
 
-    uint8_t data;
-    le_result_t r = SmbusReadReg(expander->i2cBus, expander->i2cAddr, reg, &data);
-    if (r != LE_OK)
+    // A failed read is retried at the next period
+    const uint64_t timestampUs = gpioExpander_GetTimestampUs();
+    uint16_t values;
+    uint16_t changed = 0;
+    if (gpioExpander_ReadPort(&expander, &values) == LE_OK)
     {
-        LE_ERROR("Failed to read pin field");
-        return LE_FAULT;
+        changed = (values ^ state->pollValues) & state->pollMask;
+        state->pollValues = values;
     }
 
-    *fieldData = ExtractField(data, fieldOffset, fieldWidth);
-    return LE_OK;
-}
+    // Activity returns the period to the shortest requested; idleness lengthens it step by step
+    uint32_t maxPeriodMs = state->pollBaseMs * SX1509_POLL_MAX_BACKOFF;
+    if (maxPeriodMs > SX1509_POLL_MAX_PERIOD_MS)
+    {
+        maxPeriodMs = (state->pollBaseMs > SX1509_POLL_MAX_PERIOD_MS) ?
+            state->pollBaseMs : SX1509_POLL_MAX_PERIOD_MS;
+    }
+    if (changed != 0)
+    {
+        state->pollPeriodMs = state->pollBaseMs;
+        state->pollIdleSamples = 0;
+    }
+    else if (++state->pollIdleSamples >= SX1509_POLL_IDLE_SAMPLES)
+    {
+        state->pollPeriodMs = (state->pollPeriodMs * 2 < maxPeriodMs) ?
+            state->pollPeriodMs * 2 : maxPeriodMs;
+        state->pollIdleSamples = 0;
+    }
+    le_timer_SetMsInterval(timer, state->pollPeriodMs);
+    le_timer_Start(timer);
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Writes the field associated with a signle pin from a register
- *
- * @return
- *      - LE_OK
- *      - LE_FAULT
- */
-//--------------------------------------------------------------------------------------------------
-static le_result_t Sx1509WritePinField(
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin,
-    uint8_t baseReg,                       ///< [IN] Register containing the field for pin 0
-    uint8_t fieldWidth,                    ///< [IN] Width of the field in bits
-    uint8_t fieldData                      ///< [IN] Data to write into the field.  The data should
-                                           ///  be in the least significant bit(s).
-)
-{
-    uint8_t reg;
-    uint8_t fieldOffset;
-    Sx1509ComputePinFieldAccessParameters(baseReg, pin, fieldWidth, &reg, &fieldOffset);
+    // A throttled GPIO is handed back to the interrupt once it has been quiet for long enough
+    uint16_t calmed = 0;
+    for (uint8_t pin = 0; pin < 16; pin++)
+    {
+        if ((state->stormMask & (1 << pin)) == 0)
+        {
+            continue;
+        }
+        if ((changed & (1 << pin)) != 0)
+        {
+            state->stormQuietSinceUs[pin] = timestampUs;
+        }
+        else if (timestampUs - state->stormQuietSinceUs[pin] >= SX1509_STORM_QUIET_MS * 1000ULL)
+        {
+            calmed |= (1 << pin);
+        }
+    }
 
-    le_result_t r = SmbusReadModifyWrite(
-        expander->i2cBus,
-        expander->i2cAddr,
-        reg,
-        fieldData << fieldOffset,
-        CreateMask(fieldWidth) << fieldOffset);
-    if (r != LE_OK)
+    // Handlers may remove themselves, so each record is checked just before it is called
+    const uint16_t reported =
+        changed & ((values & state->pollRisingMask) | (~values & state->pollFallingMask));
+    const gpioExpander_PortChangeCallbackFunc_t portHandlerPtr = state->portHandlerPtr;
+    void *portContextPtr = state->portContextPtr;
+    const uint16_t portRising =
+        (state->portTrigger & GPIO_EXPANDER_EDGE_RISING) != 0 ? 0xFFFF : 0;
+    const uint16_t portFalling =
+        (state->portTrigger & GPIO_EXPANDER_EDGE_FALLING) != 0 ? 0xFFFF : 0;
+    const uint16_t portReported =
+        changed & state->portHandlerMask & ((values & portRising) | (~values & portFalling));
+    for (uint8_t pin = 0; pin < 16; pin++)
     {
-        LE_ERROR("Failed to read pin field");
-        return LE_FAULT;
+        const gpioExpander_HandlerRecord_t *handler = state->pollRecords[pin];
+        if ((reported & (1 << pin)) == 0 || handler == NULL)
+        {
+            continue;
+        }
+
+        const bool rising = (state->pollRisingMask & (1 << pin)) != 0;
+        const bool falling = (state->pollFallingMask & (1 << pin)) != 0;
+        Sx1509CallChangeHandler(
+            handler,
+            (rising && falling) ? GPIO_EXPANDER_EDGE_BOTH :
+                rising ? GPIO_EXPANDER_EDGE_RISING : GPIO_EXPANDER_EDGE_FALLING,
+            ((values >> pin) & 1) == 1,
+            timestampUs);
     }
 
-    return LE_OK;
+    // Polled GPIOs watched by the port handler are reported as the interrupt would
+    if (portHandlerPtr != NULL && portReported != 0)
+    {
+        portHandlerPtr(portReported, values, timestampUs, portContextPtr);
+    }
+
+    for (uint8_t pin = 0; pin < 16; pin++)
+    {
+        if ((calmed & state->stormMask & (1 << pin)) != 0)
+        {
+            Sx1509UnthrottlePin(&expander, state, pin);
+        }
+    }
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1264,12 +5593,10 @@ static le_result_t EnableInterrupt
     bool enable
 )
 {
-    const uint8_t interruptMaskFieldWidth = 1;
     le_result_t r = Sx1509WritePinField(
         expander,
         pin,
-        SX1509_REG_INTERRUPT_MASK_A,
-        interruptMaskFieldWidth,
+        SX1509_FIELD_INTERRUPT_MASK,
         enable ? 0 : 1);
     if (r != LE_OK)
     {
@@ -1297,13 +5624,8 @@ static le_result_t WriteData
                                            ///  output to incactive
 )
 {
-    const uint8_t dataFieldWidth = 1;
-    le_result_t r = Sx1509WritePinField(
-        expander,
-        pin,
-        SX1509_REG_DATA_A,
-        dataFieldWidth,
-        active ? 1 : 0);
+    const uint16_t pinMask = (1 << pin);
+    le_result_t r = Sx1509UpdateData(expander, active ? pinMask : 0, pinMask);
 
     if (r != LE_OK)
     {
@@ -1333,23 +5655,55 @@ static le_result_t SetOutput
                                            ///  false=inactive)
 )
 {
-    if (SetOutputType(expander, pin, outputType) != LE_OK)
+    if (outputType == GPIO_EXPANDER_OUTPUT_TYPE_TRISTATE)
     {
-        return LE_FAULT;
+        LE_WARN("Tri-State API not implemented in sysfs GPIO");
+        return LE_NOT_IMPLEMENTED;
     }
-
-    if (SetPolarity(expander, pin, polarity) != LE_OK)
+    else if (
+            outputType != GPIO_EXPANDER_OUTPUT_TYPE_OPEN_DRAIN &&
+            outputType != GPIO_EXPANDER_OUTPUT_TYPE_PUSH_PULL)
     {
+        LE_ERROR("Unsupported output type");
         return LE_FAULT;
     }
 
-    if (WriteData(expander, pin, value) != LE_OK)
+    // All of the registers are written in one combined transfer.  DATA goes before DIR so that the
+    // pin starts driving the requested level the moment it becomes an output.
+    const uint16_t pinMask = (1 << pin);
+    Sx1509Batch_t batch;
+    Sx1509BatchInit(&batch, expander);
+    le_result_t r = Sx1509BatchAddPinField(
+        &batch,
+        pin,
+        SX1509_FIELD_OPEN_DRAIN,
+        outputType == GPIO_EXPANDER_OUTPUT_TYPE_OPEN_DRAIN ? 1 : 0);
+    if (r == LE_OK)
     {
-        return LE_FAULT;
+        r = Sx1509BatchAddPinField(
+            &batch,
+            pin,
+            SX1509_FIELD_POLARITY,
+            polarity == GPIO_EXPANDER_ACTIVE_HIGH ?
+                SX1509_POLARITY_NORMAL : SX1509_POLARITY_INVERTED);
+    }
+    if (r == LE_OK)
+    {
+        r = Sx1509BatchAddData(&batch, value ? pinMask : 0, pinMask);
+    }
+    if (r == LE_OK)
+    {
+        r = Sx1509BatchAddPinField(
+            &batch, pin, SX1509_FIELD_DIR, SX1509_DIRECTION_OUTPUT);
+    }
+    if (r == LE_OK)
+    {
+        r = Sx1509BatchCommit(&batch);
     }
 
-    if (SetDirection(expander, pin, false) != LE_OK)
+    if (r != LE_OK)
     {
+        LE_ERROR("Failure configuring GPIO as output.");
         return LE_FAULT;
     }
 
@@ -1387,18 +5741,15 @@ static le_result_t SetPullType
         pullDownVal = 1;
     }
 
-    const uint8_t pullFieldWidth = 1;
     const le_result_t pullUpResult = Sx1509WritePinField(
         expander,
         pin,
-        SX1509_REG_PULL_UP_A,
-        pullFieldWidth,
+        SX1509_FIELD_PULL_UP,
         pullUpVal);
     const le_result_t pullDownResult = Sx1509WritePinField(
         expander,
         pin,
-        SX1509_REG_PULL_DOWN_A,
-        pullFieldWidth,
+        SX1509_FIELD_PULL_DOWN,
         pullDownVal);
 
     if (pullUpResult != LE_OK || pullDownResult != LE_OK)
@@ -1426,12 +5777,10 @@ static le_result_t SetPolarity
     gpioExpander_Polarity_t polarity       ///< [IN] Polarity to set the GPIO to
 )
 {
-    const uint8_t polarityFieldWidth = 1;
     const le_result_t r = Sx1509WritePinField(
         expander,
         pin,
-        SX1509_REG_POLARITY_A,
-        polarityFieldWidth,
+        SX1509_FIELD_POLARITY,
         polarity == GPIO_EXPANDER_ACTIVE_HIGH ? SX1509_POLARITY_NORMAL : SX1509_POLARITY_INVERTED);
 
     if (r != LE_OK)
@@ -1445,49 +5794,31 @@ static le_result_t SetPolarity
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Sets the output type of the given GPIO
+ * Sets the direction of the given GPIO
  *
  * @return
- *      - LE_NOT_IMPLEMENTED if the output type requested was tristate
  *      - LE_OK
  *      - LE_FAULT
- *
- * @note
- *      Tristate output is currently unsupported
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t SetOutputType
+static le_result_t SetDirection
 (
     const gpioExpander_Identifier_t *expander,
     uint8_t pin,
-    gpioExpander_OutputType_t outputType   ///< [IN] Output type to configure the GPIO as
+    bool isInput                           ///< [IN] true if the GPIO is to be configured as an
+                                           ///  input or false if the GPIO is to be configured as
+                                           ///  an output
 )
 {
-    const uint8_t openDrainFieldWidth = 1;
-
-    if (outputType == GPIO_EXPANDER_OUTPUT_TYPE_TRISTATE)
-    {
-        LE_WARN("Tri-State API not implemented in sysfs GPIO");
-        return LE_NOT_IMPLEMENTED;
-    }
-    else if (
-            outputType != GPIO_EXPANDER_OUTPUT_TYPE_OPEN_DRAIN &&
-            outputType != GPIO_EXPANDER_OUTPUT_TYPE_PUSH_PULL)
-    {
-        LE_ERROR("Unsupported output type");
-        return LE_FAULT;
-    }
-
     const le_result_t r = Sx1509WritePinField(
         expander,
         pin,
-        SX1509_REG_OPEN_DRAIN_A,
-        openDrainFieldWidth,
-        outputType == GPIO_EXPANDER_OUTPUT_TYPE_OPEN_DRAIN ? 1 : 0);
+        SX1509_FIELD_DIR,
+        isInput ? SX1509_DIRECTION_INPUT : SX1509_DIRECTION_OUTPUT);
 
     if (r != LE_OK)
     {
-        LE_ERROR("Failure configuring output type");
+        LE_ERROR("Failure configuring GPIO direction.");
         return LE_FAULT;
     }
 
@@ -1496,40 +5827,31 @@ static le_result_t SetOutputType
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Sets the direction of the given GPIO
- *
- * @return
- *      - LE_OK
- *      - LE_FAULT
+ * Closes the cached I2C handles when the service is asked to terminate.
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t SetDirection
+static void SigTermEventHandler
 (
-    const gpioExpander_Identifier_t *expander,
-    uint8_t pin,
-    bool isInput                           ///< [IN] true if the GPIO is to be configured as an
-                                           ///  input or false if the GPIO is to be configured as
-                                           ///  an output
+    int sigNum
 )
 {
-    const uint8_t directionFieldWidth = 1;
-    const le_result_t r = Sx1509WritePinField(
-        expander,
-        pin,
-        SX1509_REG_DIR_A,
-        directionFieldWidth,
-        isInput ? SX1509_DIRECTION_INPUT : SX1509_DIRECTION_OUTPUT);
+    I2cCloseAllHandles();
 
-    if (r != LE_OK)
+    // The page outlives the service.  Mark everything unknown so that clients don't trust values
+    // which are no longer being kept up to date.
+    if (StatePage != NULL)
     {
-        LE_ERROR("Failure configuring GPIO direction.");
-        return LE_FAULT;
+        for (int i = 0; i < StatePage->numPorts; i++)
+        {
+            StatePageWritePort(&StatePage->ports[i], 0, 0);
+        }
     }
-
-    return LE_OK;
+    exit(EXIT_SUCCESS);
 }
 
 
 COMPONENT_INIT
 {
+    le_sig_Block(SIGTERM);
+    le_sig_SetEventHandler(SIGTERM, SigTermEventHandler);
 }
@@ -29,6 +29,50 @@ typedef void (*gpioExpander_ChangeCallbackFunc_t)
     void *contextPtr  ///< A pointer to data that was provided when the event handler was added.
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function pointer type definition for GPIO expander input interrupts which also reports when the
+ * interrupt was raised.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*gpioExpander_TimedChangeCallbackFunc_t)
+(
+    bool state,            ///< The state of the GPIO after the event which triggered the
+                           ///  interrupt.  true means the GPIO is now active.
+    uint64_t timestampUs,  ///< CLOCK_MONOTONIC in microseconds when the interrupt was raised, see
+                           ///  gpioExpander_GetTimestampUs()
+    void *contextPtr       ///< A pointer to data that was provided when the event handler was
+                           ///  added.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function pointer type definition for port level change events.  One call reports every GPIO of
+ * the port which changed in the same interrupt.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*gpioExpander_PortChangeCallbackFunc_t)
+(
+    uint16_t changedMask,  ///< Bit n is set if GPIO n has changed
+    uint16_t values,       ///< Bit n is set if GPIO n is active after the change.  Holds all GPIOs,
+                           ///  not only those which have changed.
+    uint64_t timestampUs,  ///< CLOCK_MONOTONIC in microseconds when the interrupt was raised, see
+                           ///  gpioExpander_GetTimestampUs()
+    void *contextPtr       ///< A pointer to data that was provided when the handler was added.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function pointer type definition for key presses reported by the keypad engine.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*gpioExpander_KeyHandlerFunc_t)
+(
+    uint8_t row,      ///< Row of the key.  Row n is driven by GPIO n.
+    uint8_t column,   ///< Column of the key.  Column n is read on GPIO 8 + n.
+    void *contextPtr  ///< A pointer to data that was provided when the keypad was enabled.
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * The location specification of a GPIO expander
@@ -42,15 +86,36 @@ typedef struct
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Stores the registered event handler function pointer for a GPIO pin.
+ * Stores the event handlers registered for a GPIO pin.  A zero initialized record has no handlers.
  */
 //--------------------------------------------------------------------------------------------------
 typedef struct
 {
-    gpioExpander_ChangeCallbackFunc_t handlerPtr; ///< Function to call when a change event occurs
-    void *contextPtr;                             ///< Parameter to pass to the handler function
+    le_dls_List_t subscribers;  ///< Handlers of the GPIO, allocated by the driver from a fixed pool
 } gpioExpander_HandlerRecord_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Statistics describing the cost of servicing the interrupts of a GPIO expander.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t interrupts;       ///< Number of times the interrupt handler has run
+    uint32_t transactions;     ///< Total number of I2C transactions issued by the interrupt handler
+    uint32_t lastTransactions; ///< Number of I2C transactions issued by the most recent run
+    uint32_t recoveredEdges;   ///< Number of changes which happened before DATA was read and were
+                               ///  reported from the edge sensed or the state last reported
+                               ///  instead
+    uint32_t overrunEdges;     ///< Number of events discarded because they kept being latched
+                               ///  while the interrupt handler was running
+    uint32_t unhandledEvents;  ///< Number of events discarded because the handlers of the GPIO
+                               ///  were removed before the event was dispatched
+    uint32_t throttles;        ///< Number of times a GPIO exceeded the limit of events and was
+                               ///  throttled, see gpioExpander_SetStormLimit()
+    uint16_t throttledPins;    ///< Bit n is set if GPIO n is currently throttled
+} gpioExpander_InterruptStats_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Refer to le_gpio.api documentation.
@@ -58,6 +123,29 @@ typedef struct
 //--------------------------------------------------------------------------------------------------
 typedef struct gpioExpander_ChangeCallback* gpioExpander_ChangeCallbackRef_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * A thread which services the interrupt line of one or more expanders.  See
+ * gpioExpander_CreateInterruptThread().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct gpioExpander_InterruptThread* gpioExpander_InterruptThreadRef_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Called in an interrupt thread when it starts.  Must register the handler of the interrupt line,
+ * eg. through the AddChangeEventHandler() of its le_gpio.api interface after connecting to the
+ * service, so that the handler is called in the interrupt thread.  The handler must call
+ * gpioExpander_ServiceInterruptThread().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*gpioExpander_InterruptBindFunc_t)
+(
+    gpioExpander_InterruptThreadRef_t thread,  ///< The interrupt thread
+    void *contextPtr                           ///< Context passed to
+                                               ///  gpioExpander_StartInterruptThread()
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Refer to le_gpio.api documentation.
@@ -103,6 +191,75 @@ typedef enum
     GPIO_EXPANDER_PULL_UP,
 } gpioExpander_PullUpDown_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Modes which a GPIO can be put into by gpioExpander_ConfigurePins().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    GPIO_EXPANDER_PIN_MODE_INPUT,
+    GPIO_EXPANDER_PIN_MODE_PUSH_PULL_OUTPUT,
+    GPIO_EXPANDER_PIN_MODE_OPEN_DRAIN_OUTPUT,
+} gpioExpander_PinMode_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Complete configuration of a single GPIO for use with gpioExpander_ConfigurePins().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    gpioExpander_PinMode_t mode;       ///< Input or type of output
+    gpioExpander_Polarity_t polarity;  ///< Active-high or active-low
+    bool value;                        ///< Initial value to drive (true=active).  Ignored for
+                                       ///  inputs.
+    gpioExpander_PullUpDown_t pull;    ///< Internal resistor to enable
+    gpioExpander_Edge_t edge;          ///< Edge(s) which raise an interrupt.  The interrupt of the
+                                       ///  GPIO is masked for GPIO_EXPANDER_EDGE_NONE, otherwise
+                                       ///  it is unmasked once a handler watches the GPIO.
+} gpioExpander_PinConfig_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Configuration of the LED driver of a GPIO for use with gpioExpander_SetLed().
+ *
+ * With an on time of 0 the LED glows steadily at the on intensity.  Otherwise it blinks between
+ * the on and off intensities and, on GPIOs 4-7 and 12-15, fades between them over the rise and
+ * fall times.  Times are rounded to the nearest time that the expander supports.  On and off times
+ * can be from 65 ms to 1 s in steps of 65 ms, or from 8.4 s to 16 s in steps of 520 ms.  Rise and
+ * fall times are in steps which scale with the difference between the intensities, 260 ms at
+ * full range.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint8_t onIntensity;   ///< PWM duty cycle while on, 0 (off) to 255 (fully on)
+    uint8_t offIntensity;  ///< PWM duty cycle while off, 0 to 28 in steps of 4
+    uint32_t onTimeMs;     ///< Time spent on in each blink or 0 to stay on
+    uint32_t offTimeMs;    ///< Time spent off in each blink.  Ignored if onTimeMs is 0.
+    uint32_t riseTimeMs;   ///< Time to fade from off to on or 0 not to fade
+    uint32_t fallTimeMs;   ///< Time to fade from on to off or 0 not to fade
+} gpioExpander_LedConfig_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Configuration of the keypad engine for use with gpioExpander_EnableKeypad().
+ *
+ * The engine drives the rows low one after the other for the scan time each and reads the columns,
+ * so a key press is seen within rows * scanTimeMs.  After the sleep time without a key press the
+ * engine stops scanning until a column changes, which saves power.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint8_t rows;          ///< Number of rows, 2 to 8, driven on GPIOs 0 to rows - 1
+    uint8_t columns;       ///< Number of columns, 1 to 8, read on GPIOs 8 to 8 + columns - 1
+    uint8_t scanTimeMs;    ///< Time each row is scanned for.  Rounded up to 1, 2, 4 ... 128 ms.
+    uint16_t sleepTimeMs;  ///< Idle time before the engine sleeps or 0 never to sleep.  Rounded up
+                           ///  to 128, 256, 512 ... 8192 ms.
+} gpioExpander_KeypadConfig_t;
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -231,6 +388,58 @@ LE_SHARED bool gpioExpander_Read
     uint8_t pin
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads the input value of all 16 GPIOs of the expander in a single I2C transaction.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpander_ReadPort
+(
+    const gpioExpander_Identifier_t *expander,
+    uint16_t *value  ///< [OUT] Bit n holds the value of GPIO n
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Activates or deactivates any number of GPIOs of the expander in a single I2C write.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpander_WritePort
+(
+    const gpioExpander_Identifier_t *expander,
+    uint16_t mask,   ///< [IN] Bit n is set if GPIO n is to be written
+    uint16_t value   ///< [IN] Bit n is set if GPIO n is to be activated or cleared if it is to be
+                     ///  deactivated
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Configures any number of GPIOs of the expander at once.  Each configuration register is written
+ * at most once and in an order which doesn't cause glitches on the pins.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_BAD_PARAMETER if a configuration is invalid.  Nothing is written in this case.
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpander_ConfigurePins
+(
+    const gpioExpander_Identifier_t *expander,
+    uint16_t mask,                             ///< [IN] Bit n is set if GPIO n is to be configured
+    const gpioExpander_PinConfig_t *configs    ///< [IN] An array of 16 configurations indexed by
+                                               ///  GPIO.  Only the entries selected by mask are
+                                               ///  used.
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Refer to le_gpio.api documentation.
@@ -247,6 +456,23 @@ LE_SHARED gpioExpander_ChangeCallbackRef_t gpioExpander_AddChangeEventHandler
     int32_t sampleMs
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Same as gpioExpander_AddChangeEventHandler(), but the handler also receives the time at which
+ * the interrupt was raised.  The handler is removed by gpioExpander_RemoveChangeEventHandler().
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED gpioExpander_ChangeCallbackRef_t gpioExpander_AddTimedChangeEventHandler
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    gpioExpander_HandlerRecord_t *handlerRecord,
+    gpioExpander_Edge_t trigger,
+    gpioExpander_TimedChangeCallbackFunc_t handlerPtr,
+    void *contextPtr,
+    int32_t sampleMs
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Refer to le_gpio.api documentation.
@@ -260,6 +486,45 @@ LE_SHARED void gpioExpander_RemoveChangeEventHandler
     gpioExpander_ChangeCallbackRef_t ref
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Registers a handler which is called once per interrupt for any number of GPIOs of the expander.
+ * The GPIOs sense the edge on top of those of their per GPIO handlers, which are called before the
+ * port handler, and are polled if the interrupt of the expander isn't bound.
+ *
+ * Only one port handler may be registered for each expander.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_BAD_PARAMETER if the mask is empty or the edge is GPIO_EXPANDER_EDGE_NONE
+ *      - LE_DUPLICATE if a port handler is already registered
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpander_AddPortChangeHandler
+(
+    const gpioExpander_Identifier_t *expander,
+    uint16_t mask,                                 ///< [IN] Bit n is set to watch GPIO n
+    gpioExpander_Edge_t trigger,                   ///< [IN] Change(s) to report
+    gpioExpander_PortChangeCallbackFunc_t handlerPtr,
+    void *contextPtr
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deregisters the port handler of the expander.  The GPIOs which it watched are left with the edges
+ * of their per GPIO handlers, the others stop sensing edges.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpander_RemovePortChangeHandler
+(
+    const gpioExpander_Identifier_t *expander
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Refer to le_gpio.api documentation.
@@ -294,6 +559,135 @@ LE_SHARED le_result_t gpioExpander_DisableEdgeSense
     uint8_t pin
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the debounce time of all GPIOs of the expander which have debouncing enabled.  The time is
+ * rounded up to the next of 0.5, 1, 2, 4, 8, 16, 32 or 64 ms.  The default is 0.5 ms.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_OUT_OF_RANGE if the time is longer than 64 ms
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpander_SetDebounceTime
+(
+    const gpioExpander_Identifier_t *expander,
+    uint32_t timeUs  ///< [IN] Time for which an input must be stable before a change is seen
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Enables or disables hardware debouncing of an input GPIO.  A debounced input only changes, and
+ * so only raises a change event, once it has been stable for the debounce time of the expander.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpander_SetDebounce
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    bool enable
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether hardware debouncing is enabled for a GPIO.
+ *
+ * @return
+ *      true if debouncing is enabled
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED bool gpioExpander_IsDebounced
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Drives a GPIO from the LED driver of the expander.  The GPIO is made an open-drain output which
+ * sinks the current of an LED and the expander then dims, blinks or breathes the LED by itself.
+ * The configuration applies until gpioExpander_DisableLed() is called.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_BAD_PARAMETER if breathing is requested on a GPIO other than 4-7 and 12-15, if an on
+ *        time is given without an off time or if breathing is requested with an on intensity no
+ *        greater than the off intensity
+ *      - LE_OUT_OF_RANGE if a time can't be produced or the off intensity is too large
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpander_SetLed
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin,
+    const gpioExpander_LedConfig_t *config
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stops driving a GPIO from the LED driver.  The GPIO is left as an open-drain output at high
+ * impedance, ie. with the LED off.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpander_DisableLed
+(
+    const gpioExpander_Identifier_t *expander,
+    uint8_t pin
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hands GPIOs of the expander to the keypad engine, which scans a matrix of keys by itself and
+ * raises an interrupt when a key is pressed.  The key is then reported to the handler from
+ * gpioExpander_GenericInterruptHandler() at the cost of a single two byte read.
+ *
+ * The rows become open-drain outputs and the columns become inputs with pull-ups and debouncing.
+ * The debounce time of the expander is set to half of the scan time, as the engine requires it to
+ * be shorter than the scan time.  The GPIOs must not be used through any other interface while the
+ * keypad is enabled.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_BAD_PARAMETER if the number of rows or columns isn't supported
+ *      - LE_OUT_OF_RANGE if the scan or sleep time is too long
+ *      - LE_BUSY if a GPIO of the keypad has a change or port handler, drives an LED or cascades
+ *        an interrupt
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpander_EnableKeypad
+(
+    const gpioExpander_Identifier_t *expander,
+    const gpioExpander_KeypadConfig_t *config,
+    gpioExpander_KeyHandlerFunc_t handlerPtr,  ///< [IN] Called for each key press
+    void *contextPtr                           ///< [IN] Passed to the handler
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stops the keypad engine.  The GPIOs keep the configuration given to them by
+ * gpioExpander_EnableKeypad().
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpander_DisableKeypad
+(
+    const gpioExpander_Identifier_t *expander
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Refer to le_gpio.api documentation.
@@ -354,6 +748,8 @@ LE_SHARED gpioExpander_PullUpDown_t gpioExpander_GetPullUpDown
  * Performs a software reset of the specified SX1509 GPIO expander
  *
  * Upon completion, the SX1509 will be in a state equivalent to if the POR pin had been asserted.
+ * The reset is issued immediately even while writes are deferred by gpioExpander_DeferWrites(),
+ * after the writes already queued for its bus.
  */
 //--------------------------------------------------------------------------------------------------
 LE_SHARED void gpioExpander_Reset
@@ -361,6 +757,23 @@ LE_SHARED void gpioExpander_Reset
     const gpioExpander_Identifier_t *expander  ///< I2C identifier for the GPIO expander
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Declares that the interrupt output of the expander is connected and that the caller will call
+ * gpioExpander_GenericInterruptHandler() or gpioExpander_TimedInterruptHandler() when it fires.
+ * Must be called before any change event handler of the expander is added.  Not needed for an
+ * expander serviced by an interrupt thread, see gpioExpander_CreateInterruptThread().
+ *
+ * The change event handlers of an expander without a bound interrupt are served by polling, using
+ * the sampleMs of the handlers as the period.  The polling period lengthens while the GPIOs are
+ * idle to bound the load on the bus.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void gpioExpander_BindInterrupt
+(
+    const gpioExpander_Identifier_t *expander  ///< I2C identifier for the GPIO expander
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Implements a generic interrupt handler that checks for interrupts in the status register of the
@@ -373,6 +786,180 @@ LE_SHARED void gpioExpander_GenericInterruptHandler
     const gpioExpander_HandlerRecord_t *handlers  ///< An array of 16 handler records
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Same as gpioExpander_GenericInterruptHandler(), but reports the given time to the handlers.
+ * The upstream interrupt handler should capture the time with gpioExpander_GetTimestampUs() as
+ * soon as it is called, and a handler which cascades the interrupt of another expander should pass
+ * on the time it received, so that the time excludes the I2C transfers made since.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void gpioExpander_TimedInterruptHandler
+(
+    const gpioExpander_Identifier_t *expander,     ///< I2C identifier for the GPIO expander
+    const gpioExpander_HandlerRecord_t *handlers,  ///< An array of 16 handler records
+    uint64_t timestampUs                           ///< When the interrupt was raised
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates a thread which services the interrupt line of an expander, and binds the interrupt of
+ * the expander as gpioExpander_BindInterrupt() does.  Must be called from the main thread, which
+ * keeps calling the change event handlers.
+ *
+ * Only the I2C transfers which read and clear the events are made by the thread, through I2C
+ * handles of its own.  What was read is passed back to the main thread through a lock-free queue,
+ * so the latency of the interrupt doesn't depend on how busy the main thread is with API calls,
+ * while the handlers and the rest of the driver remain single threaded.
+ *
+ * @return
+ *      The thread, which is started by gpioExpander_StartInterruptThread()
+ *
+ * @note
+ *      A real-time priority requires a maxPriority at least as high for the process in the .adef.
+ *      The thread runs at normal priority otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED gpioExpander_InterruptThreadRef_t gpioExpander_CreateInterruptThread
+(
+    const char *name,                             ///< Name of the thread
+    le_thread_Priority_t priority,                ///< Priority, eg. LE_THREAD_PRIORITY_RT_1 for
+                                                  ///  SCHED_FIFO priority 1
+    const gpioExpander_Identifier_t *expander,    ///< Expander wired to the interrupt line
+    const gpioExpander_HandlerRecord_t *handlers  ///< An array of 16 handler records
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Services an expander whose interrupt output is wired to a GPIO of the expander of an interrupt
+ * thread.  The GPIO must be configured as an input.  Its interrupt is enabled and serviced by the
+ * thread, so it must not have change event handlers.  Must be called before the thread is started.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void gpioExpander_AddCascadedInterrupt
+(
+    gpioExpander_InterruptThreadRef_t thread,     ///< The interrupt thread
+    uint8_t parentPin,                            ///< GPIO wired to the interrupt output
+    gpioExpander_Edge_t edge,                     ///< Edge of the GPIO which signals the interrupt
+    const gpioExpander_Identifier_t *expander,    ///< The cascaded expander
+    const gpioExpander_HandlerRecord_t *handlers  ///< An array of 16 handler records
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts an interrupt thread.  The I2C transport must not be changed afterwards.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void gpioExpander_StartInterruptThread
+(
+    gpioExpander_InterruptThreadRef_t thread,  ///< The interrupt thread
+    gpioExpander_InterruptBindFunc_t bindFunc, ///< Registers the handler of the interrupt line
+    void *contextPtr                           ///< Passed to bindFunc
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Services the interrupt line of an interrupt thread.  Must be called in the interrupt thread by
+ * the handler of the line.  The events of the expander, and of the cascaded expanders which
+ * signalled an interrupt, are read and cleared here and the handlers are called later in the main
+ * thread with the time of this call.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void gpioExpander_ServiceInterruptThread
+(
+    gpioExpander_InterruptThreadRef_t thread  ///< The interrupt thread
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the time used by the timestamps of the driver, which is CLOCK_MONOTONIC in microseconds.
+ * It is the same clock as le_clk_GetRelativeTime().
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED uint64_t gpioExpander_GetTimestampUs
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets statistics describing the cost of servicing the interrupts of a GPIO expander.  The number
+ * of I2C transactions per interrupt is transactions / interrupts.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void gpioExpander_GetInterruptStats
+(
+    const gpioExpander_Identifier_t *expander,  ///< I2C identifier for the GPIO expander
+    gpioExpander_InterruptStats_t *stats        ///< [OUT] Statistics since the service started
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the number of events per second above which a GPIO is considered to be storming, eg.
+ * because it is floating or noisy.  Such a GPIO is throttled: its interrupt is masked and it is
+ * polled at a low rate instead, so that it doesn't saturate the bus and starve the other GPIOs and
+ * expanders.  It is handed back to the interrupt, and its events reported as before, once it has
+ * been quiet for a couple of seconds.  Each throttle is logged and counted in the interrupt
+ * statistics.
+ *
+ * The limit is 200 events per second unless changed.  0 disables throttling.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void gpioExpander_SetStormLimit
+(
+    const gpioExpander_Identifier_t *expander,  ///< I2C identifier for the GPIO expander
+    uint32_t eventsPerSecond                    ///< Limit of events of each GPIO per second
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts deferring register writes to all GPIO expanders until the matching call to
+ * gpioExpander_FlushWrites().  The queued writes are then issued grouped by I2C bus so that
+ * expanders behind an I2C switch cost one channel switch per bus instead of one per register.
+ * The writes on each bus keep their order, but writes on different buses may be issued in a
+ * different order than they were made.  Calls may be nested.
+ *
+ * @note
+ *      While writes are deferred, functions which write to an expander return LE_OK and failures
+ *      are reported by gpioExpander_FlushWrites() instead.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void gpioExpander_DeferWrites
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Ends a gpioExpander_DeferWrites() call.  The outermost call issues all queued writes.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT if any of the queued writes failed
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpander_FlushWrites
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Publishes the state of the GPIOs of the given expanders in a shared memory page which clients
+ * can read without IPC, see gpioExpanderStatePage.h.  Expander n of the array is published as
+ * port n.  From then on every value read from or written to the GPIOs updates the page.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_FAULT if the page could not be created
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpander_PublishState
+(
+    const gpioExpander_Identifier_t *expanders,  ///< [IN] Expanders to publish
+    uint8_t numExpanders                         ///< [IN] Number of expanders in the array
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Attempt to discover the primary I2C bus number of the system.
@@ -0,0 +1,317 @@
+/**
+ * @file
+ *
+ * Dispatch functions of the table driven le_gpio.api implementation.  See gpioExpanderPinApi.h.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc. Use of this work is subject to license.
+ */
+
+#include "legato.h"
+#include "gpioExpander.h"
+#include "gpioExpanderPinApi.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpanderPin_SetInput
+(
+    gpioExpander_Polarity_t polarity,
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_SetInput(desc->expander, desc->pin, polarity);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpanderPin_SetPushPullOutput
+(
+    gpioExpander_Polarity_t polarity,
+    bool value,
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_SetPushPullOutput(desc->expander, desc->pin, polarity, value);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpanderPin_SetTriStateOutput
+(
+    gpioExpander_Polarity_t polarity,
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_SetTriStateOutput(desc->expander, desc->pin, polarity);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpanderPin_SetOpenDrainOutput
+(
+    gpioExpander_Polarity_t polarity,
+    bool value,
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_SetOpenDrainOutput(desc->expander, desc->pin, polarity, value);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpanderPin_EnablePullUp
+(
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_EnablePullUp(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpanderPin_EnablePullDown
+(
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_EnablePullDown(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpanderPin_DisableResistors
+(
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_DisableResistors(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpanderPin_Activate
+(
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_Activate(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpanderPin_Deactivate
+(
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_Deactivate(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpanderPin_SetHighZ
+(
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_SetHighZ(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+bool gpioExpanderPin_Read
+(
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_Read(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpanderPin_SetEdgeSense
+(
+    gpioExpander_Edge_t trigger,
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_SetEdgeSense(desc->expander, desc->pin, trigger);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+gpioExpander_Edge_t gpioExpanderPin_GetEdgeSense
+(
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_GetEdgeSense(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpanderPin_DisableEdgeSense
+(
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_DisableEdgeSense(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+bool gpioExpanderPin_IsOutput
+(
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_IsOutput(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+bool gpioExpanderPin_IsInput
+(
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_IsInput(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+gpioExpander_Polarity_t gpioExpanderPin_GetPolarity
+(
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_GetPolarity(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+bool gpioExpanderPin_IsActive
+(
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_IsActive(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+gpioExpander_PullUpDown_t gpioExpanderPin_GetPullUpDown
+(
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_GetPullUpDown(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+gpioExpander_ChangeCallbackRef_t gpioExpanderPin_AddChangeEventHandler
+(
+    gpioExpander_Edge_t trigger,
+    gpioExpander_ChangeCallbackFunc_t handlerPtr,
+    void *contextPtr,
+    int32_t sampleMs,
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_AddChangeEventHandler(
+        desc->expander, desc->pin, desc->handlerRecord, trigger, handlerPtr, contextPtr, sampleMs);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.h documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+gpioExpander_ChangeCallbackRef_t gpioExpanderPin_AddTimedChangeEventHandler
+(
+    gpioExpander_Edge_t trigger,
+    gpioExpander_TimedChangeCallbackFunc_t handlerPtr,
+    void *contextPtr,
+    int32_t sampleMs,
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    return gpioExpander_AddTimedChangeEventHandler(
+        desc->expander, desc->pin, desc->handlerRecord, trigger, handlerPtr, contextPtr, sampleMs);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioExpanderPin_RemoveChangeEventHandler
+(
+    gpioExpander_ChangeCallbackRef_t ref,
+    const gpioExpander_PinDescriptor_t *desc
+)
+{
+    gpioExpander_RemoveChangeEventHandler(desc->expander, desc->pin, desc->handlerRecord, ref);
+}
@@ -0,0 +1,229 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file
+ *
+ * Table driven implementation of le_gpio.api for the GPIOs of the expanders.
+ *
+ * Every GPIO is described by a constant gpioExpander_PinDescriptor_t and the le_gpio.api functions
+ * of all GPIOs share one dispatch function per API function.  The per GPIO entry points which the
+ * Legato generated server code links against are produced by GPIO_EXPANDER_PIN_API() and do
+ * nothing but load the address of the descriptor and jump to the dispatch function.  The
+ * descriptor is the last parameter of each dispatch function so that the arguments received by an
+ * entry point are already in place and don't need to be moved.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc. Use of this work is subject to license.
+ */
+//--------------------------------------------------------------------------------------------------
+#ifndef GPIO_EXPANDER_PIN_API_H
+#define GPIO_EXPANDER_PIN_API_H
+
+#include "legato.h"
+#include "gpioExpander.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Describes a single GPIO which is exposed through le_gpio.api.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const gpioExpander_Identifier_t *expander;   ///< Expander the GPIO belongs to
+    gpioExpander_HandlerRecord_t *handlerRecord; ///< Change event handler record of the GPIO
+    uint8_t pin;                                 ///< GPIO number within the expander
+} gpioExpander_PinDescriptor_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Dispatch functions.  Refer to le_gpio.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpanderPin_SetInput
+(
+    gpioExpander_Polarity_t polarity,
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED le_result_t gpioExpanderPin_SetPushPullOutput
+(
+    gpioExpander_Polarity_t polarity,
+    bool value,
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED le_result_t gpioExpanderPin_SetTriStateOutput
+(
+    gpioExpander_Polarity_t polarity,
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED le_result_t gpioExpanderPin_SetOpenDrainOutput
+(
+    gpioExpander_Polarity_t polarity,
+    bool value,
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED le_result_t gpioExpanderPin_EnablePullUp
+(
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED le_result_t gpioExpanderPin_EnablePullDown
+(
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED le_result_t gpioExpanderPin_DisableResistors
+(
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED le_result_t gpioExpanderPin_Activate
+(
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED le_result_t gpioExpanderPin_Deactivate
+(
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED le_result_t gpioExpanderPin_SetHighZ
+(
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED bool gpioExpanderPin_Read
+(
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED le_result_t gpioExpanderPin_SetEdgeSense
+(
+    gpioExpander_Edge_t trigger,
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED gpioExpander_Edge_t gpioExpanderPin_GetEdgeSense
+(
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED le_result_t gpioExpanderPin_DisableEdgeSense
+(
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED bool gpioExpanderPin_IsOutput
+(
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED bool gpioExpanderPin_IsInput
+(
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED gpioExpander_Polarity_t gpioExpanderPin_GetPolarity
+(
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED bool gpioExpanderPin_IsActive
+(
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED gpioExpander_PullUpDown_t gpioExpanderPin_GetPullUpDown
+(
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED gpioExpander_ChangeCallbackRef_t gpioExpanderPin_AddChangeEventHandler
+(
+    gpioExpander_Edge_t trigger,
+    gpioExpander_ChangeCallbackFunc_t handlerPtr,
+    void *contextPtr,
+    int32_t sampleMs,
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED gpioExpander_ChangeCallbackRef_t gpioExpanderPin_AddTimedChangeEventHandler
+(
+    gpioExpander_Edge_t trigger,
+    gpioExpander_TimedChangeCallbackFunc_t handlerPtr,
+    void *contextPtr,
+    int32_t sampleMs,
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+LE_SHARED void gpioExpanderPin_RemoveChangeEventHandler
+(
+    gpioExpander_ChangeCallbackRef_t ref,
+    const gpioExpander_PinDescriptor_t *desc
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Defines the le_gpio.api entry points of one GPIO.
+ *
+ * @param prefix
+ *      Name of the le_gpio.api interface of the GPIO, eg. mangoh_gpioExp1Pin0
+ * @param desc
+ *      Address of the gpioExpander_PinDescriptor_t of the GPIO
+ */
+//--------------------------------------------------------------------------------------------------
+#define GPIO_EXPANDER_PIN_API(prefix, desc) \
+    le_result_t prefix##_SetInput(prefix##_Polarity_t polarity) \
+        { return gpioExpanderPin_SetInput(polarity, (desc)); } \
+    le_result_t prefix##_SetPushPullOutput(prefix##_Polarity_t polarity, bool value) \
+        { return gpioExpanderPin_SetPushPullOutput(polarity, value, (desc)); } \
+    le_result_t prefix##_SetTriStateOutput(prefix##_Polarity_t polarity) \
+        { return gpioExpanderPin_SetTriStateOutput(polarity, (desc)); } \
+    le_result_t prefix##_SetOpenDrainOutput(prefix##_Polarity_t polarity, bool value) \
+        { return gpioExpanderPin_SetOpenDrainOutput(polarity, value, (desc)); } \
+    le_result_t prefix##_EnablePullUp(void) \
+        { return gpioExpanderPin_EnablePullUp(desc); } \
+    le_result_t prefix##_EnablePullDown(void) \
+        { return gpioExpanderPin_EnablePullDown(desc); } \
+    le_result_t prefix##_DisableResistors(void) \
+        { return gpioExpanderPin_DisableResistors(desc); } \
+    le_result_t prefix##_Activate(void) \
+        { return gpioExpanderPin_Activate(desc); } \
+    le_result_t prefix##_Deactivate(void) \
+        { return gpioExpanderPin_Deactivate(desc); } \
+    le_result_t prefix##_SetHighZ(void) \
+        { return gpioExpanderPin_SetHighZ(desc); } \
+    bool prefix##_Read(void) \
+        { return gpioExpanderPin_Read(desc); } \
+    le_result_t prefix##_SetEdgeSense(prefix##_Edge_t trigger) \
+        { return gpioExpanderPin_SetEdgeSense(trigger, (desc)); } \
+    prefix##_Edge_t prefix##_GetEdgeSense(void) \
+        { return (prefix##_Edge_t)gpioExpanderPin_GetEdgeSense(desc); } \
+    le_result_t prefix##_DisableEdgeSense(void) \
+        { return gpioExpanderPin_DisableEdgeSense(desc); } \
+    bool prefix##_IsOutput(void) \
+        { return gpioExpanderPin_IsOutput(desc); } \
+    bool prefix##_IsInput(void) \
+        { return gpioExpanderPin_IsInput(desc); } \
+    prefix##_Polarity_t prefix##_GetPolarity(void) \
+        { return (prefix##_Polarity_t)gpioExpanderPin_GetPolarity(desc); } \
+    bool prefix##_IsActive(void) \
+        { return gpioExpanderPin_IsActive(desc); } \
+    prefix##_PullUpDown_t prefix##_GetPullUpDown(void) \
+        { return (prefix##_PullUpDown_t)gpioExpanderPin_GetPullUpDown(desc); } \
+    prefix##_ChangeEventHandlerRef_t prefix##_AddChangeEventHandler( \
+        prefix##_Edge_t trigger, \
+        prefix##_ChangeCallbackFunc_t handlerPtr, \
+        void *contextPtr, \
+        int32_t sampleMs) \
+        { \
+            return (prefix##_ChangeEventHandlerRef_t)gpioExpanderPin_AddChangeEventHandler( \
+                trigger, handlerPtr, contextPtr, sampleMs, (desc)); \
+        } \
+    void prefix##_RemoveChangeEventHandler(prefix##_ChangeEventHandlerRef_t ref) \
+        { gpioExpanderPin_RemoveChangeEventHandler((gpioExpander_ChangeCallbackRef_t)ref, (desc)); }
+
+#endif // GPIO_EXPANDER_PIN_API_H
@@ -0,0 +1,73 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file
+ *
+ * Layout of the shared memory page in which the service publishes the state of the GPIOs of the
+ * expanders.  The page is written by the service only and mapped read-only by clients, see
+ * gpioExpanderStateClient.h.
+ *
+ * Each port is protected by a sequence lock.  The writer makes the sequence odd, updates the port
+ * and then makes the sequence even again.  A reader copies the port and retries if the sequence was
+ * odd or changed during the copy, so neither side ever blocks.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc. Use of this work is subject to license.
+ */
+//--------------------------------------------------------------------------------------------------
+#ifndef GPIO_EXPANDER_STATE_PAGE_H
+#define GPIO_EXPANDER_STATE_PAGE_H
+
+#include <stdint.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Name of the POSIX shared memory object which holds the page.
+ */
+//--------------------------------------------------------------------------------------------------
+#define GPIO_EXPANDER_STATE_PAGE_NAME "/mangoh_gpioExpander"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Identifies a page with the layout described by this file.  The version changes whenever the
+ * layout does.
+ */
+//--------------------------------------------------------------------------------------------------
+#define GPIO_EXPANDER_STATE_PAGE_MAGIC   0x53583135
+#define GPIO_EXPANDER_STATE_PAGE_VERSION 1
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of expanders which can be published.
+ */
+//--------------------------------------------------------------------------------------------------
+#define GPIO_EXPANDER_STATE_PAGE_MAX_PORTS 3
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The published state of the 16 GPIOs of one expander.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t sequence;      ///< Odd while the port is being updated
+    uint16_t value;         ///< Bit n holds the value of GPIO n as le_gpio_Read() reports it
+    uint16_t validMask;     ///< Bit n is set once the value of GPIO n is known
+    uint64_t updateTimeUs;  ///< le_clk_GetRelativeTime() of the last update in microseconds
+} gpioExpanderStatePage_Port_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The shared memory page.  Port n holds expander number n + 1.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t magic;     ///< GPIO_EXPANDER_STATE_PAGE_MAGIC
+    uint32_t version;   ///< GPIO_EXPANDER_STATE_PAGE_VERSION
+    uint32_t numPorts;  ///< Number of ports in use
+    uint32_t reserved;
+    gpioExpanderStatePage_Port_t ports[GPIO_EXPANDER_STATE_PAGE_MAX_PORTS];
+} gpioExpanderStatePage_t;
+
+#endif // GPIO_EXPANDER_STATE_PAGE_H
@@ -0,0 +1,97 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file
+ *
+ * The I2C transport used by the GPIO expander driver.  By default the driver talks to the SX1509
+ * through the Linux i2c-dev interface, but any implementation of gpioExpander_I2cTransport_t may be
+ * installed in its place.  This allows the driver to be run against a model of the device on a
+ * host without the mangOH hardware.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc. Use of this work is subject to license.
+ */
+//--------------------------------------------------------------------------------------------------
+#ifndef GPIO_EXPANDER_TRANSPORT_H
+#define GPIO_EXPANDER_TRANSPORT_H
+
+#include "legato.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of register writes which may be combined into a single transfer.
+ */
+//--------------------------------------------------------------------------------------------------
+#define GPIO_EXPANDER_MAX_REG_WRITES 8
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A single register write within a combined transfer.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint8_t reg;   ///< Register to write
+    uint8_t data;  ///< Value to write into the register
+} gpioExpander_I2cRegWrite_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Operations which an I2C transport must provide.
+ *
+ * Handles are opaque non-negative integers which are bound to a single device.  Functions which
+ * perform a transfer return a negative value and set errno on failure, in the same manner as the
+ * i2c_smbus_* helpers in i2c-utils.h.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const char *name;  ///< Name of the transport for use in log messages
+
+    /// Open a handle for access to the device at i2cAddr on bus i2cBus.  Returns the handle or
+    /// LE_FAULT.
+    int (*open)(uint8_t i2cBus, uint8_t i2cAddr);
+
+    /// Release a handle returned by open
+    void (*close)(int handle);
+
+    /// Read a single register.  Returns the value of the register.
+    int (*readByteData)(int handle, uint8_t reg);
+
+    /// Write a single register.  Returns 0 on success.
+    int (*writeByteData)(int handle, uint8_t reg, uint8_t data);
+
+    /// Read length consecutive registers starting at reg.  Returns the number of bytes read.
+    int (*readBlockData)(int handle, uint8_t reg, uint8_t length, uint8_t *data);
+
+    /// Write length consecutive registers starting at reg.  Returns 0 on success.
+    int (*writeBlockData)(int handle, uint8_t reg, uint8_t length, const uint8_t *data);
+
+    /// Perform count register writes, in order, as one combined transfer with a repeated START
+    /// between writes so that no other bus traffic can come in between.  count is at most
+    /// GPIO_EXPANDER_MAX_REG_WRITES.  Returns 0 on success.  May be NULL, in which case the writes
+    /// are issued one by one with writeByteData.
+    int (*writeRegs)(
+        int handle, uint8_t i2cAddr, const gpioExpander_I2cRegWrite_t *writes, uint8_t count);
+} gpioExpander_I2cTransport_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Installs the transport to be used for all subsequent I2C accesses.  Handles opened through the
+ * previous transport are closed and the state of the expanders is discarded, so the transport must
+ * be installed before any handler is registered or interrupt is bound.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_BUSY if an expander is in use
+ *
+ * @note
+ *      Passing NULL restores the Linux i2c-dev transport.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpander_SetI2cTransport
+(
+    const gpioExpander_I2cTransport_t *transport
+);
+
+#endif // GPIO_EXPANDER_TRANSPORT_H
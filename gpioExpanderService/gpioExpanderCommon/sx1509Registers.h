@@ -0,0 +1,139 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file
+ *
+ * Register map of the SX1509 GPIO expander.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc. Use of this work is subject to license.
+ */
+//--------------------------------------------------------------------------------------------------
+#ifndef SX1509_REGISTERS_H
+#define SX1509_REGISTERS_H
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The SX1509 GPIO Register Address - See datasheet for descriptions
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum {
+    // Device and IO Banks
+    SX1509_REG_INPUT_DISABLE_B               = 0x00,
+    SX1509_REG_INPUT_DISABLE_A               = 0x01,
+    SX1509_REG_LONG_SLEW_B                   = 0x02,
+    SX1509_REG_LONG_SLEW_A                   = 0x03,
+    SX1509_REG_LOW_DRIVE_B                   = 0x04,
+    SX1509_REG_LOW_DRIVE_A                   = 0x05,
+    SX1509_REG_PULL_UP_B                     = 0x06,
+    SX1509_REG_PULL_UP_A                     = 0x07,
+    SX1509_REG_PULL_DOWN_B                   = 0x08,
+    SX1509_REG_PULL_DOWN_A                   = 0x09,
+    SX1509_REG_OPEN_DRAIN_B                  = 0x0A,
+    SX1509_REG_OPEN_DRAIN_A                  = 0x0B,
+    SX1509_REG_POLARITY_B                    = 0x0C,
+    SX1509_REG_POLARITY_A                    = 0x0D,
+    SX1509_REG_DIR_B                         = 0x0E,
+    SX1509_REG_DIR_A                         = 0x0F,
+    SX1509_REG_DATA_B                        = 0x10,
+    SX1509_REG_DATA_A                        = 0x11,
+    SX1509_REG_INTERRUPT_MASK_B              = 0x12,
+    SX1509_REG_INTERRUPT_MASK_A              = 0x13,
+    SX1509_REG_SENSE_HIGH_B                  = 0x14,
+    SX1509_REG_SENSE_LOW_B                   = 0x15,
+    SX1509_REG_SENSE_HIGH_A                  = 0x16,
+    SX1509_REG_SENSE_LOW_A                   = 0x17,
+    SX1509_REG_INTERRUPT_SOURCE_B            = 0x18,
+    SX1509_REG_INTERRUPT_SOURCE_A            = 0x19,
+    SX1509_REG_EVENT_STATUS_B                = 0x1A,
+    SX1509_REG_EVENT_STATUS_A                = 0x1B,
+    SX1509_REG_LEVEL_SHIFTER_1               = 0x1C,
+    SX1509_REG_LEVEL_SHIFTER_2               = 0x1D,
+    SX1509_REG_CLOCK                         = 0x1E,
+    SX1509_REG_MISC                          = 0x1F,
+    SX1509_REG_LED_DRIVER_ENABLE_B           = 0x20,
+    SX1509_REG_LED_DRIVER_ENABLE_A           = 0x21,
+    // Debounce and Keypad Engine
+    SX1509_REG_DEBOUNCE_CONFIG               = 0x22,
+    SX1509_REG_DEBOUNCE_ENABLE_B             = 0x23,
+    SX1509_REG_DEBOUNCE_ENABLE_A             = 0x24,
+    SX1509_REG_KEY_CONFIG_1                  = 0x25,
+    SX1509_REG_KEY_CONFIG_2                  = 0x26,
+    SX1509_REG_KEY_DATA_1                    = 0x27,
+    SX1509_REG_KEY_DATA_2                    = 0x28,
+    // LED Driver (PWM, blinking, breathing)
+    SX1509_REG_T_ON_0                        = 0x29,
+    SX1509_REG_I_ON_0                        = 0x2A,
+    SX1509_REG_OFF_0                         = 0x2B,
+    SX1509_REG_T_ON_1                        = 0x2C,
+    SX1509_REG_I_ON_1                        = 0x2D,
+    SX1509_REG_OFF_1                         = 0x2E,
+    SX1509_REG_T_ON_2                        = 0x2F,
+    SX1509_REG_I_ON_2                        = 0x30,
+    SX1509_REG_OFF_2                         = 0x31,
+    SX1509_REG_T_ON_3                        = 0x32,
+    SX1509_REG_I_ON_3                        = 0x33,
+    SX1509_REG_OFF_3                         = 0x34,
+    SX1509_REG_T_ON_4                        = 0x35,
+    SX1509_REG_I_ON_4                        = 0x36,
+    SX1509_REG_OFF_4                         = 0x37,
+    SX1509_REG_T_RISE_4                      = 0x38,
+    SX1509_REG_T_FALL_4                      = 0x39,
+    SX1509_REG_T_ON_5                        = 0x3A,
+    SX1509_REG_I_ON_5                        = 0x3B,
+    SX1509_REG_OFF_5                         = 0x3C,
+    SX1509_REG_T_RISE_5                      = 0x3D,
+    SX1509_REG_T_FALL_5                      = 0x3E,
+    SX1509_REG_T_ON_6                        = 0x3F,
+    SX1509_REG_I_ON_6                        = 0x40,
+    SX1509_REG_OFF_6                         = 0x41,
+    SX1509_REG_T_RISE_6                      = 0x42,
+    SX1509_REG_T_FALL_6                      = 0x43,
+    SX1509_REG_T_ON_7                        = 0x44,
+    SX1509_REG_I_ON_7                        = 0x45,
+    SX1509_REG_OFF_7                         = 0x46,
+    SX1509_REG_T_RISE_7                      = 0x47,
+    SX1509_REG_T_FALL_7                      = 0x48,
+    SX1509_REG_T_ON_8                        = 0x49,
+    SX1509_REG_I_ON_8                        = 0x4A,
+    SX1509_REG_OFF_8                         = 0x4B,
+    SX1509_REG_T_ON_9                        = 0x4C,
+    SX1509_REG_I_ON_9                        = 0x4D,
+    SX1509_REG_OFF_9                         = 0x4E,
+    SX1509_REG_T_ON_10                       = 0x4F,
+    SX1509_REG_I_ON_10                       = 0x50,
+    SX1509_REG_OFF_10                        = 0x51,
+    SX1509_REG_T_ON_11                       = 0x52,
+    SX1509_REG_I_ON_11                       = 0x53,
+    SX1509_REG_OFF_11                        = 0x54,
+    SX1509_REG_T_ON_12                       = 0x55,
+    SX1509_REG_I_ON_12                       = 0x56,
+    SX1509_REG_OFF_12                        = 0x57,
+    SX1509_REG_T_RISE_12                     = 0x58,
+    SX1509_REG_T_FALL_12                     = 0x59,
+    SX1509_REG_T_ON_13                       = 0x5A,
+    SX1509_REG_I_ON_13                       = 0x5B,
+    SX1509_REG_OFF_13                        = 0x5C,
+    SX1509_REG_T_RISE_13                     = 0x5D,
+    SX1509_REG_T_FALL_13                     = 0x5E,
+    SX1509_REG_T_ON_14                       = 0x5F,
+    SX1509_REG_I_ON_14                       = 0x60,
+    SX1509_REG_OFF_14                        = 0x61,
+    SX1509_REG_T_RISE_14                     = 0x62,
+    SX1509_REG_T_FALL_14                     = 0x63,
+    SX1509_REG_T_ON_15                       = 0x64,
+    SX1509_REG_I_ON_15                       = 0x65,
+    SX1509_REG_OFF_15                        = 0x66,
+    SX1509_REG_T_RISE_15                     = 0x67,
+    SX1509_REG_T_FALL_15                     = 0x68,
+    // Miscellaneous
+    SX1509_REG_HIGH_INPUT_B                  = 0x69,
+    SX1509_REG_HIGH_INPUT_A                  = 0x6A,
+    // Software Reset
+    SX1509_REG_RESET                         = 0x7D,
+    // Test (not to be written)
+    SX1509_REG_TEST_1                        = 0x7E,
+    SX1509_REG_TEST_2                        = 0x7F,
+} Sx1509GpioExpanderReg_t;
+
+#endif // SX1509_REGISTERS_H
@@ -0,0 +1,1214 @@
+/**
+ * @file
+ *
+ * Implementation of gpioExpander.api.  Each function looks up the descriptor of the requested GPIO
+ * and calls the same dispatch function which serves the per GPIO le_gpio.api interfaces, so both
+ * views of a GPIO share its state, including its change event handlers.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc. Use of this work is subject to license.
+ */
+
+#include "legato.h"
+#include "interfaces.h"
+#include "gpioExpander.h"
+#include "gpioExpanderPinApi.h"
+#include "gpioExpanderMux.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A change event handler registered through gpioExpander.api.  The driver calls handlers with the
+ * state of the GPIO only, so this record adds the expander and GPIO numbers which the client's
+ * handler expects.  Records are allocated from MuxHandlerPool and the client is given a safe
+ * reference to the record, as any number of clients may watch the same GPIO.  The records are kept
+ * in MuxHandlerList so that those of a client can be removed when its session closes.
+ *
+ * Exactly one of the client's handlers is set.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    mangoh_gpioExpander_ChangeCallbackFunc_t handlerPtr; ///< Client's handler or NULL if unused
+    mangoh_gpioExpander_TimedChangeCallbackFunc_t timedHandlerPtr; ///< Client's timed handler or
+                                                                   ///  NULL if unused
+    void *contextPtr;                                    ///< Client's context
+    uint8_t expander;                                    ///< Expander number
+    uint8_t pin;                                         ///< GPIO number within the expander
+    gpioExpander_ChangeCallbackRef_t driverRef;          ///< Handler registered with the driver
+    le_msg_SessionRef_t sessionRef;                      ///< Session of the client
+    void *ref;                                           ///< Reference given to the client
+    le_dls_Link_t link;                                  ///< Link in MuxHandlerList
+} MuxHandler_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of change event handlers which clients can register through gpioExpander.api.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MUX_MAX_HANDLERS 32
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A key press handler registered through gpioExpander.api.  There is one record per expander and
+ * the client is given a safe reference to it.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    mangoh_gpioExpander_KeyCallbackFunc_t handlerPtr; ///< Client's handler or NULL if unused
+    void *contextPtr;                                 ///< Client's context
+    uint8_t expander;                                 ///< Expander number
+    le_msg_SessionRef_t sessionRef;                   ///< Session of the client
+    void *ref;                                        ///< Reference given to the client
+} MuxKeyHandler_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A port change handler registered through gpioExpander.api.  There is one record per expander and
+ * the client is given a safe reference to it.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    mangoh_gpioExpander_PortChangeCallbackFunc_t handlerPtr; ///< Client's handler or NULL if unused
+    void *contextPtr;                                        ///< Client's context
+    uint8_t expander;                                        ///< Expander number
+    le_msg_SessionRef_t sessionRef;                          ///< Session of the client
+    void *ref;                                               ///< Reference given to the client
+} MuxPortHandler_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The GPIOs which are served, as set by gpioExpanderMux_SetPins().
+ */
+//--------------------------------------------------------------------------------------------------
+static const gpioExpander_PinDescriptor_t (*MuxPins)[16];
+static const uint16_t *MuxExposedPins;
+static uint8_t MuxNumExpanders;
+
+static le_mem_PoolRef_t MuxHandlerPool;
+static le_ref_MapRef_t MuxHandlerRefMap;
+static le_dls_List_t MuxHandlerList = LE_DLS_LIST_INIT;
+static MuxKeyHandler_t MuxKeyHandlers[GPIO_EXPANDER_MUX_MAX_EXPANDERS];
+static le_ref_MapRef_t MuxKeyHandlerRefMap;
+static MuxPortHandler_t MuxPortHandlers[GPIO_EXPANDER_MUX_MAX_EXPANDERS];
+static le_ref_MapRef_t MuxPortHandlerRefMap;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the descriptor of a GPIO which a client has asked for.
+ *
+ * @return
+ *      The descriptor or NULL if the GPIO isn't served, in which case the client has been killed
+ */
+//--------------------------------------------------------------------------------------------------
+static const gpioExpander_PinDescriptor_t *GetPin
+(
+    uint8_t expander,  ///< [IN] Expander number
+    uint8_t pin        ///< [IN] GPIO number within the expander
+)
+{
+    if (expander < 1 || expander > MuxNumExpanders || pin >= 16 ||
+        (MuxExposedPins[expander - 1] & (1 << pin)) == 0)
+    {
+        LE_KILL_CLIENT("GPIO %d of expander %d is not available", pin, expander);
+        return NULL;
+    }
+
+    return &MuxPins[expander - 1][pin];
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the descriptor of GPIO 0 of an expander which a client has asked for.  It identifies the
+ * expander for port level operations.
+ *
+ * @return
+ *      The descriptor or NULL if the expander isn't served, in which case the client has been
+ *      killed
+ */
+//--------------------------------------------------------------------------------------------------
+static const gpioExpander_PinDescriptor_t *GetPort
+(
+    uint8_t expander  ///< [IN] Expander number
+)
+{
+    if (expander < 1 || expander > MuxNumExpanders)
+    {
+        LE_KILL_CLIENT("Expander %d is not available", expander);
+        return NULL;
+    }
+
+    return &MuxPins[expander - 1][0];
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Passes a change event from the driver on to the handler of the client.
+ */
+//--------------------------------------------------------------------------------------------------
+static void MuxChangeHandler
+(
+    bool state,            ///< [IN] State of the GPIO after the change
+    uint64_t timestampUs,  ///< [IN] Time of the interrupt
+    void *contextPtr       ///< [IN] The MuxHandler_t of the GPIO
+)
+{
+    MuxHandler_t *handler = contextPtr;
+    if (handler->timedHandlerPtr != NULL)
+    {
+        handler->timedHandlerPtr(
+            handler->expander, handler->pin, state, timestampUs, handler->contextPtr);
+    }
+    else
+    {
+        handler->handlerPtr(handler->expander, handler->pin, state, handler->contextPtr);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Validates a change event handler reference of a client.
+ *
+ * @return
+ *      The handler or NULL if the reference is invalid, in which case the client has been killed
+ */
+//--------------------------------------------------------------------------------------------------
+static MuxHandler_t *GetHandler
+(
+    void *ref,  ///< [IN] Reference returned to the client
+    bool timed  ///< [IN] true if the reference is of a timed handler
+)
+{
+    MuxHandler_t *handler = le_ref_Lookup(MuxHandlerRefMap, ref);
+    if (handler == NULL ||
+        (timed ? (void *)handler->timedHandlerPtr : (void *)handler->handlerPtr) == NULL)
+    {
+        LE_KILL_CLIENT("Invalid handler reference");
+        return NULL;
+    }
+
+    return handler;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Registers the plain or timed change event handler of a client
+ *
+ * @return
+ *      The reference to return to the client or NULL if too many handlers are registered
+ */
+//--------------------------------------------------------------------------------------------------
+static void *AddHandler
+(
+    uint8_t expander,
+    uint8_t pin,
+    mangoh_gpioExpander_Edge_t trigger,
+    mangoh_gpioExpander_ChangeCallbackFunc_t handlerPtr,
+    mangoh_gpioExpander_TimedChangeCallbackFunc_t timedHandlerPtr,
+    void *contextPtr,
+    int32_t sampleMs
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return NULL;
+    }
+
+    MuxHandler_t *handler = le_mem_TryAlloc(MuxHandlerPool);
+    if (handler == NULL)
+    {
+        LE_ERROR("Too many change event handlers");
+        return NULL;
+    }
+    handler->handlerPtr = handlerPtr;
+    handler->timedHandlerPtr = timedHandlerPtr;
+    handler->contextPtr = contextPtr;
+    handler->expander = expander;
+    handler->pin = pin;
+    handler->sessionRef = mangoh_gpioExpander_GetClientSessionRef();
+
+    handler->driverRef = gpioExpanderPin_AddTimedChangeEventHandler(
+        (gpioExpander_Edge_t)trigger, &MuxChangeHandler, handler, sampleMs, desc);
+    if (handler->driverRef == NULL)
+    {
+        le_mem_Release(handler);
+        return NULL;
+    }
+
+    handler->ref = le_ref_CreateRef(MuxHandlerRefMap, handler);
+    le_dls_Queue(&MuxHandlerList, &handler->link);
+    return handler->ref;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deregisters the change event handler of a client
+ */
+//--------------------------------------------------------------------------------------------------
+static void RemoveHandler
+(
+    MuxHandler_t *handler  ///< [IN] The handler to remove
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = &MuxPins[handler->expander - 1][handler->pin];
+    gpioExpanderPin_RemoveChangeEventHandler(handler->driverRef, desc);
+    le_ref_DeleteRef(MuxHandlerRefMap, handler->ref);
+    le_dls_Remove(&MuxHandlerList, &handler->link);
+    le_mem_Release(handler);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Passes a key press from the driver on to the handler of the client.
+ */
+//--------------------------------------------------------------------------------------------------
+static void MuxKeyHandler
+(
+    uint8_t row,      ///< [IN] Row of the key
+    uint8_t column,   ///< [IN] Column of the key
+    void *contextPtr  ///< [IN] The MuxKeyHandler_t of the expander
+)
+{
+    MuxKeyHandler_t *handler = contextPtr;
+    handler->handlerPtr(handler->expander, row, column, handler->contextPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Passes a port change event from the driver on to the handler of the client.
+ */
+//--------------------------------------------------------------------------------------------------
+static void MuxPortHandler
+(
+    uint16_t changedMask,  ///< [IN] GPIOs which have changed
+    uint16_t values,       ///< [IN] State of all GPIOs after the change
+    uint64_t timestampUs,  ///< [IN] Time the interrupt was serviced
+    void *contextPtr       ///< [IN] The MuxPortHandler_t of the expander
+)
+{
+    MuxPortHandler_t *handler = contextPtr;
+    handler->handlerPtr(handler->expander, changedMask, values, timestampUs, handler->contextPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deregisters the port change handler of a client
+ */
+//--------------------------------------------------------------------------------------------------
+static void RemovePortHandler
+(
+    MuxPortHandler_t *handler  ///< [IN] The handler to remove
+)
+{
+    gpioExpander_RemovePortChangeHandler(MuxPins[handler->expander - 1][0].expander);
+    le_ref_DeleteRef(MuxPortHandlerRefMap, handler->ref);
+    handler->handlerPtr = NULL;
+    handler->contextPtr = NULL;
+    handler->sessionRef = NULL;
+    handler->ref = NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deregisters the key press handler of a client and stops the keypad engine
+ */
+//--------------------------------------------------------------------------------------------------
+static void RemoveKeyHandler
+(
+    MuxKeyHandler_t *handler  ///< [IN] The handler to remove
+)
+{
+    gpioExpander_DisableKeypad(MuxPins[handler->expander - 1][0].expander);
+    le_ref_DeleteRef(MuxKeyHandlerRefMap, handler->ref);
+    handler->handlerPtr = NULL;
+    handler->contextPtr = NULL;
+    handler->sessionRef = NULL;
+    handler->ref = NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Removes the handlers of a client whose session has closed, so that no events are sent to it and
+ * the next client can register them again.
+ */
+//--------------------------------------------------------------------------------------------------
+static void MuxSessionCloseHandler
+(
+    le_msg_SessionRef_t sessionRef,  ///< [IN] Session which has closed
+    void *contextPtr                 ///< [IN] Unused
+)
+{
+    le_dls_Link_t *linkPtr = le_dls_Peek(&MuxHandlerList);
+    while (linkPtr != NULL)
+    {
+        MuxHandler_t *handler = CONTAINER_OF(linkPtr, MuxHandler_t, link);
+        linkPtr = le_dls_PeekNext(&MuxHandlerList, linkPtr);
+        if (handler->sessionRef == sessionRef)
+        {
+            RemoveHandler(handler);
+        }
+    }
+
+    for (int i = 0; i < MuxNumExpanders; i++)
+    {
+        if (MuxPortHandlers[i].handlerPtr != NULL && MuxPortHandlers[i].sessionRef == sessionRef)
+        {
+            RemovePortHandler(&MuxPortHandlers[i]);
+        }
+        if (MuxKeyHandlers[i].handlerPtr != NULL && MuxKeyHandlers[i].sessionRef == sessionRef)
+        {
+            RemoveKeyHandler(&MuxKeyHandlers[i]);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the GPIOs which are served by gpioExpander.api.
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioExpanderMux_SetPins
+(
+    const gpioExpander_PinDescriptor_t (*pins)[16],
+    const uint16_t *exposedPins,
+    uint8_t numExpanders
+)
+{
+    LE_ASSERT(numExpanders <= GPIO_EXPANDER_MUX_MAX_EXPANDERS);
+    MuxPins = pins;
+    MuxExposedPins = exposedPins;
+    MuxNumExpanders = numExpanders;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_SetInput
+(
+    uint8_t expander,
+    uint8_t pin,
+    mangoh_gpioExpander_Polarity_t polarity
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpanderPin_SetInput((gpioExpander_Polarity_t)polarity, desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_SetPushPullOutput
+(
+    uint8_t expander,
+    uint8_t pin,
+    mangoh_gpioExpander_Polarity_t polarity,
+    bool value
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpanderPin_SetPushPullOutput((gpioExpander_Polarity_t)polarity, value, desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_SetTriStateOutput
+(
+    uint8_t expander,
+    uint8_t pin,
+    mangoh_gpioExpander_Polarity_t polarity
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpanderPin_SetTriStateOutput((gpioExpander_Polarity_t)polarity, desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_SetOpenDrainOutput
+(
+    uint8_t expander,
+    uint8_t pin,
+    mangoh_gpioExpander_Polarity_t polarity,
+    bool value
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpanderPin_SetOpenDrainOutput((gpioExpander_Polarity_t)polarity, value, desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_EnablePullUp
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpanderPin_EnablePullUp(desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_EnablePullDown
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpanderPin_EnablePullDown(desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_DisableResistors
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpanderPin_DisableResistors(desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_Activate
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpanderPin_Activate(desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_Deactivate
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpanderPin_Deactivate(desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_SetHighZ
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpanderPin_SetHighZ(desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+bool mangoh_gpioExpander_Read
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return false;
+    }
+
+    return gpioExpanderPin_Read(desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_SetEdgeSense
+(
+    uint8_t expander,
+    uint8_t pin,
+    mangoh_gpioExpander_Edge_t trigger
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpanderPin_SetEdgeSense((gpioExpander_Edge_t)trigger, desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+mangoh_gpioExpander_Edge_t mangoh_gpioExpander_GetEdgeSense
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return MANGOH_GPIOEXPANDER_EDGE_NONE;
+    }
+
+    return (mangoh_gpioExpander_Edge_t)gpioExpanderPin_GetEdgeSense(desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_DisableEdgeSense
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpanderPin_DisableEdgeSense(desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+bool mangoh_gpioExpander_IsOutput
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return false;
+    }
+
+    return gpioExpanderPin_IsOutput(desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+bool mangoh_gpioExpander_IsInput
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return false;
+    }
+
+    return gpioExpanderPin_IsInput(desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+mangoh_gpioExpander_Polarity_t mangoh_gpioExpander_GetPolarity
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return MANGOH_GPIOEXPANDER_ACTIVE_HIGH;
+    }
+
+    return (mangoh_gpioExpander_Polarity_t)gpioExpanderPin_GetPolarity(desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+bool mangoh_gpioExpander_IsActive
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return false;
+    }
+
+    return gpioExpanderPin_IsActive(desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+mangoh_gpioExpander_PullUpDown_t mangoh_gpioExpander_GetPullUpDown
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return MANGOH_GPIOEXPANDER_PULL_OFF;
+    }
+
+    return (mangoh_gpioExpander_PullUpDown_t)gpioExpanderPin_GetPullUpDown(desc);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+mangoh_gpioExpander_ChangeEventHandlerRef_t mangoh_gpioExpander_AddChangeEventHandler
+(
+    uint8_t expander,
+    uint8_t pin,
+    mangoh_gpioExpander_Edge_t trigger,
+    mangoh_gpioExpander_ChangeCallbackFunc_t handlerPtr,
+    void *contextPtr,
+    int32_t sampleMs
+)
+{
+    return AddHandler(expander, pin, trigger, handlerPtr, NULL, contextPtr, sampleMs);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+void mangoh_gpioExpander_RemoveChangeEventHandler
+(
+    mangoh_gpioExpander_ChangeEventHandlerRef_t ref
+)
+{
+    MuxHandler_t *handler = GetHandler(ref, false);
+    if (handler != NULL)
+    {
+        RemoveHandler(handler);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+mangoh_gpioExpander_TimedChangeEventHandlerRef_t mangoh_gpioExpander_AddTimedChangeEventHandler
+(
+    uint8_t expander,
+    uint8_t pin,
+    mangoh_gpioExpander_Edge_t trigger,
+    mangoh_gpioExpander_TimedChangeCallbackFunc_t handlerPtr,
+    void *contextPtr,
+    int32_t sampleMs
+)
+{
+    return AddHandler(expander, pin, trigger, NULL, handlerPtr, contextPtr, sampleMs);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+void mangoh_gpioExpander_RemoveTimedChangeEventHandler
+(
+    mangoh_gpioExpander_TimedChangeEventHandlerRef_t ref
+)
+{
+    MuxHandler_t *handler = GetHandler(ref, true);
+    if (handler != NULL)
+    {
+        RemoveHandler(handler);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+mangoh_gpioExpander_PortChangeEventHandlerRef_t mangoh_gpioExpander_AddPortChangeEventHandler
+(
+    uint8_t expander,
+    uint16_t mask,
+    mangoh_gpioExpander_Edge_t trigger,
+    mangoh_gpioExpander_PortChangeCallbackFunc_t handlerPtr,
+    void *contextPtr
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPort(expander);
+    if (desc == NULL)
+    {
+        return NULL;
+    }
+
+    if ((MuxExposedPins[expander - 1] & mask) != mask)
+    {
+        LE_KILL_CLIENT("Mask 0x%04x selects GPIOs of expander %d which are not available",
+                       mask, expander);
+        return NULL;
+    }
+
+    MuxPortHandler_t *handler = &MuxPortHandlers[expander - 1];
+    if (handler->handlerPtr != NULL)
+    {
+        LE_KILL_CLIENT("Port handler of expander %d is already registered", expander);
+        return NULL;
+    }
+
+    handler->handlerPtr = handlerPtr;
+    handler->contextPtr = contextPtr;
+    handler->expander = expander;
+    if (gpioExpander_AddPortChangeHandler(
+            desc->expander, mask, (gpioExpander_Edge_t)trigger, &MuxPortHandler, handler) != LE_OK)
+    {
+        handler->handlerPtr = NULL;
+        handler->contextPtr = NULL;
+        return NULL;
+    }
+
+    handler->sessionRef = mangoh_gpioExpander_GetClientSessionRef();
+    handler->ref = le_ref_CreateRef(MuxPortHandlerRefMap, handler);
+    return handler->ref;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+void mangoh_gpioExpander_RemovePortChangeEventHandler
+(
+    mangoh_gpioExpander_PortChangeEventHandlerRef_t ref
+)
+{
+    MuxPortHandler_t *handler = le_ref_Lookup(MuxPortHandlerRefMap, ref);
+    if (handler == NULL)
+    {
+        LE_KILL_CLIENT("Invalid handler reference");
+        return;
+    }
+
+    RemovePortHandler(handler);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+mangoh_gpioExpander_KeyEventHandlerRef_t mangoh_gpioExpander_AddKeyEventHandler
+(
+    uint8_t expander,
+    uint8_t rows,
+    uint8_t columns,
+    uint8_t scanTimeMs,
+    uint16_t sleepTimeMs,
+    mangoh_gpioExpander_KeyCallbackFunc_t handlerPtr,
+    void *contextPtr
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPort(expander);
+    if (desc == NULL)
+    {
+        return NULL;
+    }
+
+    // Rows are GPIOs 0 to 7 and columns GPIOs 8 to 15.  Counts which are too large are rejected
+    // by the driver.
+    const uint16_t keypadPins = (rows <= 8 && columns <= 8) ?
+        (((1 << rows) - 1) | (((1 << columns) - 1) << 8)) : 0;
+    if ((MuxExposedPins[expander - 1] & keypadPins) != keypadPins)
+    {
+        LE_KILL_CLIENT("Keypad uses GPIOs of expander %d which are not available", expander);
+        return NULL;
+    }
+
+    MuxKeyHandler_t *handler = &MuxKeyHandlers[expander - 1];
+    if (handler->handlerPtr != NULL)
+    {
+        LE_KILL_CLIENT("Keypad of expander %d is already in use", expander);
+        return NULL;
+    }
+
+    const gpioExpander_KeypadConfig_t config =
+    {
+        .rows        = rows,
+        .columns     = columns,
+        .scanTimeMs  = scanTimeMs,
+        .sleepTimeMs = sleepTimeMs,
+    };
+    if (gpioExpander_EnableKeypad(desc->expander, &config, &MuxKeyHandler, handler) != LE_OK)
+    {
+        return NULL;
+    }
+    handler->handlerPtr = handlerPtr;
+    handler->contextPtr = contextPtr;
+    handler->expander = expander;
+    handler->sessionRef = mangoh_gpioExpander_GetClientSessionRef();
+    handler->ref = le_ref_CreateRef(MuxKeyHandlerRefMap, handler);
+
+    return handler->ref;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+void mangoh_gpioExpander_RemoveKeyEventHandler
+(
+    mangoh_gpioExpander_KeyEventHandlerRef_t ref
+)
+{
+    MuxKeyHandler_t *handler = le_ref_Lookup(MuxKeyHandlerRefMap, ref);
+    if (handler == NULL)
+    {
+        LE_KILL_CLIENT("Invalid handler reference");
+        return;
+    }
+
+    RemoveKeyHandler(handler);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_ReadPort
+(
+    uint8_t expander,
+    uint16_t *valuePtr
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPort(expander);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpander_ReadPort(desc->expander, valuePtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_WritePort
+(
+    uint8_t expander,
+    uint16_t mask,
+    uint16_t value
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPort(expander);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpander_WritePort(desc->expander, mask, value);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_SetDebounce
+(
+    uint8_t expander,
+    uint8_t pin,
+    bool enable
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpander_SetDebounce(desc->expander, desc->pin, enable);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+bool mangoh_gpioExpander_IsDebounced
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return false;
+    }
+
+    return gpioExpander_IsDebounced(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_SetDebounceTime
+(
+    uint8_t expander,
+    uint32_t timeUs
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPort(expander);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpander_SetDebounceTime(desc->expander, timeUs);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_SetLed
+(
+    uint8_t expander,
+    uint8_t pin,
+    uint8_t onIntensity,
+    uint8_t offIntensity,
+    uint32_t onTimeMs,
+    uint32_t offTimeMs,
+    uint32_t riseTimeMs,
+    uint32_t fallTimeMs
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    const gpioExpander_LedConfig_t config =
+    {
+        .onIntensity  = onIntensity,
+        .offIntensity = offIntensity,
+        .onTimeMs     = onTimeMs,
+        .offTimeMs    = offTimeMs,
+        .riseTimeMs   = riseTimeMs,
+        .fallTimeMs   = fallTimeMs,
+    };
+    return gpioExpander_SetLed(desc->expander, desc->pin, &config);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t mangoh_gpioExpander_DisableLed
+(
+    uint8_t expander,
+    uint8_t pin
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPin(expander, pin);
+    if (desc == NULL)
+    {
+        return LE_BAD_PARAMETER;
+    }
+
+    return gpioExpander_DisableLed(desc->expander, desc->pin);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+void mangoh_gpioExpander_GetInterruptStats
+(
+    uint8_t expander,
+    uint32_t *interruptsPtr,
+    uint32_t *recoveredEdgesPtr,
+    uint32_t *overrunEdgesPtr,
+    uint32_t *throttlesPtr,
+    uint16_t *throttledPinsPtr
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPort(expander);
+    if (desc == NULL)
+    {
+        return;
+    }
+
+    gpioExpander_InterruptStats_t stats;
+    gpioExpander_GetInterruptStats(desc->expander, &stats);
+    *interruptsPtr = stats.interrupts;
+    *recoveredEdgesPtr = stats.recoveredEdges;
+    *overrunEdgesPtr = stats.overrunEdges;
+    *throttlesPtr = stats.throttles;
+    *throttledPinsPtr = stats.throttledPins;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Refer to gpioExpander.api documentation.
+ */
+//--------------------------------------------------------------------------------------------------
+void mangoh_gpioExpander_SetStormLimit
+(
+    uint8_t expander,
+    uint32_t eventsPerSecond
+)
+{
+    const gpioExpander_PinDescriptor_t *desc = GetPort(expander);
+    if (desc == NULL)
+    {
+        return;
+    }
+
+    gpioExpander_SetStormLimit(desc->expander, eventsPerSecond);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates the pool of change event handlers and the reference maps of all handlers, and removes
+ * the handlers of clients which go away.  The GPIOs are set by the board configuration component.
+ */
+//--------------------------------------------------------------------------------------------------
+COMPONENT_INIT
+{
+    MuxHandlerPool = le_mem_CreatePool("MuxHandlers", sizeof(MuxHandler_t));
+    le_mem_ExpandPool(MuxHandlerPool, MUX_MAX_HANDLERS);
+    MuxHandlerRefMap = le_ref_CreateMap("MuxHandlers", MUX_MAX_HANDLERS);
+    MuxKeyHandlerRefMap = le_ref_CreateMap("MuxKeyHandlers", GPIO_EXPANDER_MUX_MAX_EXPANDERS);
+    MuxPortHandlerRefMap = le_ref_CreateMap("MuxPortHandlers", GPIO_EXPANDER_MUX_MAX_EXPANDERS);
+    le_msg_AddServiceCloseHandler(
+        mangoh_gpioExpander_GetServiceRef(), &MuxSessionCloseHandler, NULL);
+}
@@ -0,0 +1,42 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file
+ *
+ * Implementation of gpioExpander.api, which serves the GPIOs of all expanders of the board through
+ * a single service.  The board configuration component hands its pin descriptor table to this
+ * component during initialization.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc. Use of this work is subject to license.
+ */
+//--------------------------------------------------------------------------------------------------
+#ifndef GPIO_EXPANDER_MUX_H
+#define GPIO_EXPANDER_MUX_H
+
+#include "legato.h"
+#include "gpioExpanderPinApi.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of expanders which can be served.
+ */
+//--------------------------------------------------------------------------------------------------
+#define GPIO_EXPANDER_MUX_MAX_EXPANDERS 3
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the GPIOs which are served by gpioExpander.api.  Must be called from COMPONENT_INIT of the
+ * board configuration component.  The tables must remain valid for the life of the process.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void gpioExpanderMux_SetPins
+(
+    const gpioExpander_PinDescriptor_t (*pins)[16], ///< [IN] Descriptors of the GPIOs of each
+                                                    ///  expander.  Row n is expander number n + 1.
+    const uint16_t *exposedPins,                    ///< [IN] For each expander, bit n is set if
+                                                    ///  GPIO n may be accessed by clients
+    uint8_t numExpanders                            ///< [IN] Number of rows in both tables
+);
+
+#endif // GPIO_EXPANDER_MUX_H
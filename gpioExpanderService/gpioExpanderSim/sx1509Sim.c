@@ -0,0 +1,970 @@
+/**
+ * @file
+ *
+ * An in-process register model of the SX1509 GPIO expander which implements the I2C transport
+ * interface of the GPIO expander driver.  See sx1509Sim.h for a description of what is modelled.
+ *
+ * The model covers the GPIO functionality of the device.  The LED driver and debounce registers can
+ * be written and read back but have no effect on the pins.  Of the keypad engine, only the
+ * reporting of key presses injected with sx1509Sim_PressKey() is modelled.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc. Use of this work is subject to license.
+ */
+
+#include "legato.h"
+#include "sx1509Sim.h"
+#include "sx1509Registers.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of simulated devices.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SIM_MAX_DEVICES 4
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the register address space of the SX1509.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SIM_NUM_REGS 0x80
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of START, repeated START and STOP conditions in a register read and a register write.
+ * Each condition is counted as one bit time.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SIM_READ_CONDITIONS  3
+#define SIM_WRITE_CONDITIONS 2
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Bit 0 of RegMisc.  While it is clear, as after reset, a read of RegDataB or RegDataA clears the
+ * events of that bank and so releases NINT.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SIM_MISC_NO_AUTOCLEAR 0x01
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * State of a simulated SX1509.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    bool inUse;                                ///< true if this slot holds a device
+    uint8_t i2cBus;                            ///< I2C bus that the device is on
+    uint8_t i2cAddr;                           ///< I2C address of the device
+    uint8_t regs[SIM_NUM_REGS];                ///< Register file.  DATA holds the output latch.
+    uint8_t lastResetByte;                     ///< Last byte written to RegReset
+    uint16_t inputs;                           ///< Levels applied to the pins from outside
+    uint16_t sampled;                          ///< Last input value used for edge detection
+    bool keyPending;                           ///< true from a key press until the key data is read
+    bool clearInputsPending;                   ///< true if clearInputs is yet to be applied
+    uint16_t clearInputs;                      ///< Levels applied when the events are next cleared
+    sx1509Sim_InterruptHandlerFunc_t handler;  ///< Called when NINT becomes asserted
+    void *contextPtr;                          ///< Passed to handler
+} SimDevice_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The ON intensity register of each LED driver channel.  These reset to full intensity.
+ */
+//--------------------------------------------------------------------------------------------------
+static const uint8_t IOnRegs[] =
+{
+    SX1509_REG_I_ON_0,  SX1509_REG_I_ON_1,  SX1509_REG_I_ON_2,  SX1509_REG_I_ON_3,
+    SX1509_REG_I_ON_4,  SX1509_REG_I_ON_5,  SX1509_REG_I_ON_6,  SX1509_REG_I_ON_7,
+    SX1509_REG_I_ON_8,  SX1509_REG_I_ON_9,  SX1509_REG_I_ON_10, SX1509_REG_I_ON_11,
+    SX1509_REG_I_ON_12, SX1509_REG_I_ON_13, SX1509_REG_I_ON_14, SX1509_REG_I_ON_15,
+};
+
+static SimDevice_t Devices[SIM_MAX_DEVICES];
+static sx1509Sim_Stats_t Stats;
+static uint32_t BusSpeedHz;
+static le_mutex_Ref_t Mutex;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads a 16 bit value from a pair of registers where the B register holds the upper byte and is
+ * immediately followed by the A register.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint16_t GetBankPair
+(
+    const SimDevice_t *device,
+    uint8_t regB
+)
+{
+    return (device->regs[regB] << 8) | device->regs[regB + 1];
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Writes a 16 bit value into a pair of registers.  See GetBankPair().
+ */
+//--------------------------------------------------------------------------------------------------
+static void SetBankPair
+(
+    SimDevice_t *device,
+    uint8_t regB,
+    uint16_t value
+)
+{
+    device->regs[regB] = value >> 8;
+    device->regs[regB + 1] = value & 0xFF;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Puts a device into its power on reset state.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ResetDevice
+(
+    SimDevice_t *device
+)
+{
+    memset(device->regs, 0, sizeof(device->regs));
+    SetBankPair(device, SX1509_REG_DIR_B, 0xFFFF);
+    SetBankPair(device, SX1509_REG_DATA_B, 0xFFFF);
+    SetBankPair(device, SX1509_REG_INTERRUPT_MASK_B, 0xFFFF);
+    device->regs[SX1509_REG_KEY_DATA_1] = 0xFF;
+    device->regs[SX1509_REG_KEY_DATA_2] = 0xFF;
+    for (int i = 0; i < NUM_ARRAY_MEMBERS(IOnRegs); i++)
+    {
+        device->regs[IOnRegs[i]] = 0xFF;
+    }
+    device->lastResetByte = 0;
+    device->keyPending = false;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Computes the level of every pin of a device.
+ *
+ * @return
+ *      Bit n is the level of IO n
+ */
+//--------------------------------------------------------------------------------------------------
+static uint16_t ComputePinLevels
+(
+    const SimDevice_t *device
+)
+{
+    const uint16_t isInput = GetBankPair(device, SX1509_REG_DIR_B);
+    const uint16_t polarity = GetBankPair(device, SX1509_REG_POLARITY_B);
+    const uint16_t latch = GetBankPair(device, SX1509_REG_DATA_B);
+    const uint16_t openDrain = GetBankPair(device, SX1509_REG_OPEN_DRAIN_B);
+
+    // An open drain output only drives low, otherwise the pin floats to the external level
+    const uint16_t driven = latch ^ polarity;
+    const uint16_t released = ~isInput & openDrain & driven;
+    const uint16_t external = isInput | released;
+
+    return (external & device->inputs) | (~external & driven);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Computes the value that a read of DATA_B:DATA_A returns.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint16_t ComputeDataValue
+(
+    const SimDevice_t *device
+)
+{
+    const uint16_t inputDisable = GetBankPair(device, SX1509_REG_INPUT_DISABLE_B);
+    const uint16_t polarity = GetBankPair(device, SX1509_REG_POLARITY_B);
+    return (ComputePinLevels(device) ^ polarity) & ~inputDisable;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether NINT of a device is asserted.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool InterruptAsserted
+(
+    const SimDevice_t *device
+)
+{
+    return device->keyPending || GetBankPair(device, SX1509_REG_INTERRUPT_SOURCE_B) != 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Samples the inputs of a device and latches any edges which match the configured sense into
+ * RegEventStatus and, for unmasked IOs, RegInterruptSource.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DetectEdges
+(
+    SimDevice_t *device
+)
+{
+    const uint16_t sample = ComputeDataValue(device);
+    const uint16_t changed = (sample ^ device->sampled) & GetBankPair(device, SX1509_REG_DIR_B);
+    device->sampled = sample;
+
+    uint16_t events = 0;
+    for (int pin = 0; pin < 16; pin++)
+    {
+        if ((changed & (1 << pin)) == 0)
+        {
+            continue;
+        }
+
+        const uint8_t senseReg = SX1509_REG_SENSE_LOW_A - (pin / 4);
+        const uint8_t sense = (device->regs[senseReg] >> ((pin % 4) * 2)) & 0x3;
+        const bool rising = (sample & (1 << pin)) != 0;
+        if ((rising && (sense & 0x1)) || (!rising && (sense & 0x2)))
+        {
+            events |= (1 << pin);
+        }
+    }
+
+    const uint16_t mask = GetBankPair(device, SX1509_REG_INTERRUPT_MASK_B);
+    SetBankPair(
+        device,
+        SX1509_REG_EVENT_STATUS_B,
+        GetBankPair(device, SX1509_REG_EVENT_STATUS_B) | events);
+    SetBankPair(
+        device,
+        SX1509_REG_INTERRUPT_SOURCE_B,
+        GetBankPair(device, SX1509_REG_INTERRUPT_SOURCE_B) | (events & ~mask));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Applies the levels set by sx1509Sim_SetInputsOnClear(), if any.  Edges are detected once the
+ * write which cleared the events has completed.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ApplyClearInputs
+(
+    SimDevice_t *device
+)
+{
+    if (device->clearInputsPending)
+    {
+        device->inputs = device->clearInputs;
+        device->clearInputsPending = false;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs the side effects of writing one register.
+ */
+//--------------------------------------------------------------------------------------------------
+static void WriteRegister
+(
+    SimDevice_t *device,
+    uint8_t reg,
+    uint8_t data
+)
+{
+    switch (reg)
+    {
+        case SX1509_REG_RESET:
+            if (device->lastResetByte == 0x12 && data == 0x34)
+            {
+                ResetDevice(device);
+            }
+            else
+            {
+                device->lastResetByte = data;
+            }
+            return;
+
+        case SX1509_REG_EVENT_STATUS_B:
+        case SX1509_REG_INTERRUPT_SOURCE_B:
+            // Writing 1 clears the bit in both RegEventStatus and RegInterruptSource
+            device->regs[SX1509_REG_EVENT_STATUS_B] &= ~data;
+            device->regs[SX1509_REG_INTERRUPT_SOURCE_B] &= ~data;
+            ApplyClearInputs(device);
+            return;
+
+        case SX1509_REG_EVENT_STATUS_A:
+        case SX1509_REG_INTERRUPT_SOURCE_A:
+            device->regs[SX1509_REG_EVENT_STATUS_A] &= ~data;
+            device->regs[SX1509_REG_INTERRUPT_SOURCE_A] &= ~data;
+            ApplyClearInputs(device);
+            return;
+
+        case SX1509_REG_KEY_DATA_1:
+        case SX1509_REG_KEY_DATA_2:
+        case SX1509_REG_TEST_1:
+        case SX1509_REG_TEST_2:
+            // Read only
+            return;
+
+        default:
+            device->regs[reg] = data;
+            return;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Returns the value that a read of one register yields.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint8_t ReadRegister
+(
+    const SimDevice_t *device,
+    uint8_t reg
+)
+{
+    if (reg == SX1509_REG_DATA_B)
+    {
+        return ComputeDataValue(device) >> 8;
+    }
+    if (reg == SX1509_REG_DATA_A)
+    {
+        return ComputeDataValue(device) & 0xFF;
+    }
+
+    return device->regs[reg];
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finds a device by address.
+ *
+ * @return
+ *      The device or NULL if there is no device at the address
+ */
+//--------------------------------------------------------------------------------------------------
+static SimDevice_t *FindDevice
+(
+    uint8_t i2cBus,
+    uint8_t i2cAddr
+)
+{
+    for (int i = 0; i < SIM_MAX_DEVICES; i++)
+    {
+        if (Devices[i].inUse && Devices[i].i2cBus == i2cBus && Devices[i].i2cAddr == i2cAddr)
+        {
+            return &Devices[i];
+        }
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finds a device by address and fails if it does not exist.
+ */
+//--------------------------------------------------------------------------------------------------
+static SimDevice_t *GetDevice
+(
+    uint8_t i2cBus,
+    uint8_t i2cAddr
+)
+{
+    SimDevice_t *device = FindDevice(i2cBus, i2cAddr);
+    LE_FATAL_IF(
+        device == NULL, "No simulated device on I2C bus %d at address 0x%x", i2cBus, i2cAddr);
+    return device;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Accounts for a transfer on the bus and waits for as long as it would take at the set speed.
+ *
+ * Must be called with the mutex held so that transfers are serialized as on a real bus.
+ */
+//--------------------------------------------------------------------------------------------------
+static void AccountTransfer
+(
+    uint32_t bytes,      ///< [IN] Bytes on the bus including address and register bytes
+    uint32_t conditions  ///< [IN] Number of START, repeated START and STOP conditions
+)
+{
+    Stats.transactions++;
+    Stats.bytes += bytes;
+    Stats.syscalls++;
+
+    if (BusSpeedHz == 0)
+    {
+        return;
+    }
+
+    // Every byte is followed by an ACK bit
+    const uint64_t bits = (bytes * 9) + conditions;
+    const uint64_t durationNs = (bits * 1000000000ULL) / BusSpeedHz;
+    Stats.busTimeNs += durationNs;
+
+    struct timespec start;
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do
+    {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+    } while ((uint64_t)((now.tv_sec - start.tv_sec) * 1000000000LL +
+                        (now.tv_nsec - start.tv_nsec)) < durationNs);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Completes a write transfer.  Edges caused by the write are detected and, if NINT has become
+ * asserted, the interrupt handler is called after the mutex has been released.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FinishWriteAndUnlock
+(
+    SimDevice_t *device,
+    bool wasAsserted
+)
+{
+    DetectEdges(device);
+    const bool raise = !wasAsserted && InterruptAsserted(device);
+    const sx1509Sim_InterruptHandlerFunc_t handler = device->handler;
+    void *contextPtr = device->contextPtr;
+    le_mutex_Unlock(Mutex);
+
+    if (raise && handler != NULL)
+    {
+        handler(contextPtr);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Transport operation: opens a handle to a simulated device.
+ *
+ * @return
+ *      The handle or LE_FAULT if there is no device at the address
+ */
+//--------------------------------------------------------------------------------------------------
+static int SimOpen
+(
+    uint8_t i2cBus,
+    uint8_t i2cAddr
+)
+{
+    le_mutex_Lock(Mutex);
+    SimDevice_t *device = FindDevice(i2cBus, i2cAddr);
+    Stats.syscalls += 2;
+    le_mutex_Unlock(Mutex);
+
+    if (device == NULL)
+    {
+        LE_ERROR("No simulated device on I2C bus %d at address 0x%x", i2cBus, i2cAddr);
+        return LE_FAULT;
+    }
+
+    return device - Devices;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Transport operation: closes a handle.  Handles hold no resources so only the statistics are
+ * updated.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SimClose
+(
+    int handle
+)
+{
+    le_mutex_Lock(Mutex);
+    Stats.syscalls++;
+    le_mutex_Unlock(Mutex);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks that a handle and register range are valid.
+ *
+ * @return
+ *      The device the handle refers to or NULL with errno set
+ */
+//--------------------------------------------------------------------------------------------------
+static SimDevice_t *CheckAccess
+(
+    int handle,
+    uint8_t reg,
+    uint8_t length
+)
+{
+    if (handle < 0 || handle >= SIM_MAX_DEVICES || !Devices[handle].inUse)
+    {
+        errno = EBADF;
+        return NULL;
+    }
+
+    if (reg + length > SIM_NUM_REGS)
+    {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    return &Devices[handle];
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Transport operation: reads consecutive registers.
+ *
+ * @return
+ *      The number of bytes read or -1 with errno set
+ */
+//--------------------------------------------------------------------------------------------------
+static int SimReadBlockData
+(
+    int handle,
+    uint8_t reg,
+    uint8_t length,
+    uint8_t *data
+)
+{
+    le_mutex_Lock(Mutex);
+    SimDevice_t *device = CheckAccess(handle, reg, length);
+    if (device == NULL)
+    {
+        le_mutex_Unlock(Mutex);
+        return -1;
+    }
+
+    AccountTransfer(3 + length, SIM_READ_CONDITIONS);
+    for (int i = 0; i < length; i++)
+    {
+        data[i] = ReadRegister(device, reg + i);
+        if ((reg + i == SX1509_REG_DATA_B || reg + i == SX1509_REG_DATA_A) &&
+            (device->regs[SX1509_REG_MISC] & SIM_MISC_NO_AUTOCLEAR) == 0)
+        {
+            // Autoclear of the events of the bank.  Registers after DATA in the same transfer
+            // already read as cleared.
+            const bool bankB = (reg + i == SX1509_REG_DATA_B);
+            device->regs[bankB ? SX1509_REG_EVENT_STATUS_B : SX1509_REG_EVENT_STATUS_A] = 0;
+            device->regs[bankB ? SX1509_REG_INTERRUPT_SOURCE_B : SX1509_REG_INTERRUPT_SOURCE_A] = 0;
+        }
+        else if (reg + i == SX1509_REG_KEY_DATA_1 || reg + i == SX1509_REG_KEY_DATA_2)
+        {
+            // Reading the key data releases NINT and the register reads as no key until the next
+            // key press
+            device->regs[reg + i] = 0xFF;
+            device->keyPending = false;
+        }
+    }
+    le_mutex_Unlock(Mutex);
+
+    return length;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Transport operation: writes consecutive registers.
+ *
+ * @return
+ *      0 on success or -1 with errno set
+ */
+//--------------------------------------------------------------------------------------------------
+static int SimWriteBlockData
+(
+    int handle,
+    uint8_t reg,
+    uint8_t length,
+    const uint8_t *data
+)
+{
+    le_mutex_Lock(Mutex);
+    SimDevice_t *device = CheckAccess(handle, reg, length);
+    if (device == NULL)
+    {
+        le_mutex_Unlock(Mutex);
+        return -1;
+    }
+
+    AccountTransfer(2 + length, SIM_WRITE_CONDITIONS);
+    const bool wasAsserted = InterruptAsserted(device);
+    for (int i = 0; i < length; i++)
+    {
+        WriteRegister(device, reg + i, data[i]);
+    }
+    FinishWriteAndUnlock(device, wasAsserted);
+
+    return 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Transport operation: reads a single register.
+ *
+ * @return
+ *      The value of the register or -1 with errno set
+ */
+//--------------------------------------------------------------------------------------------------
+static int SimReadByteData
+(
+    int handle,
+    uint8_t reg
+)
+{
+    uint8_t data;
+    if (SimReadBlockData(handle, reg, 1, &data) < 0)
+    {
+        return -1;
+    }
+
+    return data;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Transport operation: writes a single register.
+ *
+ * @return
+ *      0 on success or -1 with errno set
+ */
+//--------------------------------------------------------------------------------------------------
+static int SimWriteByteData
+(
+    int handle,
+    uint8_t reg,
+    uint8_t data
+)
+{
+    return SimWriteBlockData(handle, reg, 1, &data);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Transport operation: performs several register writes as one combined transfer.  The writes are
+ * applied in order and edges are only detected once the whole transfer has completed, as no other
+ * traffic can come in between on a real bus either.
+ *
+ * @return
+ *      0 on success or -1 with errno set
+ */
+//--------------------------------------------------------------------------------------------------
+static int SimWriteRegs
+(
+    int handle,
+    uint8_t i2cAddr,
+    const gpioExpander_I2cRegWrite_t *writes,
+    uint8_t count
+)
+{
+    le_mutex_Lock(Mutex);
+    SimDevice_t *device = CheckAccess(handle, 0, 0);
+    if (device == NULL || count > GPIO_EXPANDER_MAX_REG_WRITES)
+    {
+        if (device != NULL)
+        {
+            errno = EINVAL;
+        }
+        le_mutex_Unlock(Mutex);
+        return -1;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        if (writes[i].reg >= SIM_NUM_REGS)
+        {
+            errno = EINVAL;
+            le_mutex_Unlock(Mutex);
+            return -1;
+        }
+    }
+
+    // Each message carries the address, register and data bytes and is introduced by a START or
+    // repeated START.  A single STOP ends the transfer.
+    AccountTransfer(3 * count, count + 1);
+    const bool wasAsserted = InterruptAsserted(device);
+    for (int i = 0; i < count; i++)
+    {
+        WriteRegister(device, writes[i].reg, writes[i].data);
+    }
+    FinishWriteAndUnlock(device, wasAsserted);
+
+    return 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Transport which accesses the simulated devices.
+ */
+//--------------------------------------------------------------------------------------------------
+static const gpioExpander_I2cTransport_t SimTransport =
+{
+    .name           = "SX1509 simulator",
+    .open           = SimOpen,
+    .close          = SimClose,
+    .readByteData   = SimReadByteData,
+    .writeByteData  = SimWriteByteData,
+    .readBlockData  = SimReadBlockData,
+    .writeBlockData = SimWriteBlockData,
+    .writeRegs      = SimWriteRegs,
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Public function definitions
+//-------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the transport which accesses the simulated devices
+ */
+//--------------------------------------------------------------------------------------------------
+const gpioExpander_I2cTransport_t *sx1509Sim_GetTransport
+(
+    void
+)
+{
+    return &SimTransport;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds a simulated SX1509 in its reset state
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_DUPLICATE if a device already exists at the address
+ *      - LE_NO_MEMORY if the maximum number of devices has been reached
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t sx1509Sim_AddDevice
+(
+    uint8_t i2cBus,
+    uint8_t i2cAddr
+)
+{
+    le_result_t result = LE_NO_MEMORY;
+
+    le_mutex_Lock(Mutex);
+    if (FindDevice(i2cBus, i2cAddr) != NULL)
+    {
+        result = LE_DUPLICATE;
+    }
+    else
+    {
+        for (int i = 0; i < SIM_MAX_DEVICES; i++)
+        {
+            SimDevice_t *device = &Devices[i];
+            if (!device->inUse)
+            {
+                memset(device, 0, sizeof(*device));
+                device->inUse = true;
+                device->i2cBus = i2cBus;
+                device->i2cAddr = i2cAddr;
+                device->inputs = 0xFFFF;
+                ResetDevice(device);
+                device->sampled = ComputeDataValue(device);
+                result = LE_OK;
+                break;
+            }
+        }
+    }
+    le_mutex_Unlock(Mutex);
+
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the speed of the simulated bus
+ */
+//--------------------------------------------------------------------------------------------------
+void sx1509Sim_SetBusSpeed
+(
+    uint32_t hz
+)
+{
+    le_mutex_Lock(Mutex);
+    BusSpeedHz = hz;
+    le_mutex_Unlock(Mutex);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Drives the pins of a simulated device from outside
+ */
+//--------------------------------------------------------------------------------------------------
+void sx1509Sim_SetInputs
+(
+    uint8_t i2cBus,
+    uint8_t i2cAddr,
+    uint16_t levels
+)
+{
+    le_mutex_Lock(Mutex);
+    SimDevice_t *device = GetDevice(i2cBus, i2cAddr);
+    const bool wasAsserted = InterruptAsserted(device);
+    device->inputs = levels;
+    FinishWriteAndUnlock(device, wasAsserted);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Drives the pins of a simulated device from outside once its events are next cleared
+ */
+//--------------------------------------------------------------------------------------------------
+void sx1509Sim_SetInputsOnClear
+(
+    uint8_t i2cBus,
+    uint8_t i2cAddr,
+    uint16_t levels
+)
+{
+    le_mutex_Lock(Mutex);
+    SimDevice_t *device = GetDevice(i2cBus, i2cAddr);
+    device->clearInputs = levels;
+    device->clearInputsPending = true;
+    le_mutex_Unlock(Mutex);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reports a key press from the keypad engine of a simulated device
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t sx1509Sim_PressKey
+(
+    uint8_t i2cBus,
+    uint8_t i2cAddr,
+    uint8_t row,
+    uint8_t column
+)
+{
+    le_mutex_Lock(Mutex);
+    SimDevice_t *device = GetDevice(i2cBus, i2cAddr);
+    const uint8_t keyConfig = device->regs[SX1509_REG_KEY_CONFIG_2];
+    const uint8_t rows = (keyConfig >> 3) & 0x7;
+    if (rows == 0 || row > rows || column > (keyConfig & 0x7))
+    {
+        le_mutex_Unlock(Mutex);
+        return LE_NOT_PERMITTED;
+    }
+
+    const bool wasAsserted = InterruptAsserted(device);
+    device->regs[SX1509_REG_KEY_DATA_1] = ~(1 << column);
+    device->regs[SX1509_REG_KEY_DATA_2] = ~(1 << row);
+    device->keyPending = true;
+    FinishWriteAndUnlock(device, wasAsserted);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the level of the pins of a simulated device
+ */
+//--------------------------------------------------------------------------------------------------
+uint16_t sx1509Sim_GetPinLevels
+(
+    uint8_t i2cBus,
+    uint8_t i2cAddr
+)
+{
+    le_mutex_Lock(Mutex);
+    const uint16_t levels = ComputePinLevels(GetDevice(i2cBus, i2cAddr));
+    le_mutex_Unlock(Mutex);
+
+    return levels;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads a register of a simulated device without going through the simulated bus
+ */
+//--------------------------------------------------------------------------------------------------
+uint8_t sx1509Sim_PeekReg
+(
+    uint8_t i2cBus,
+    uint8_t i2cAddr,
+    uint8_t reg
+)
+{
+    LE_ASSERT(reg < SIM_NUM_REGS);
+
+    le_mutex_Lock(Mutex);
+    const uint8_t data = ReadRegister(GetDevice(i2cBus, i2cAddr), reg);
+    le_mutex_Unlock(Mutex);
+
+    return data;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether the NINT output of a simulated device is asserted
+ */
+//--------------------------------------------------------------------------------------------------
+bool sx1509Sim_IsInterruptAsserted
+(
+    uint8_t i2cBus,
+    uint8_t i2cAddr
+)
+{
+    le_mutex_Lock(Mutex);
+    const bool asserted = InterruptAsserted(GetDevice(i2cBus, i2cAddr));
+    le_mutex_Unlock(Mutex);
+
+    return asserted;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the function to be called when NINT of a simulated device becomes asserted
+ */
+//--------------------------------------------------------------------------------------------------
+void sx1509Sim_SetInterruptHandler
+(
+    uint8_t i2cBus,
+    uint8_t i2cAddr,
+    sx1509Sim_InterruptHandlerFunc_t handler,
+    void *contextPtr
+)
+{
+    le_mutex_Lock(Mutex);
+    SimDevice_t *device = GetDevice(i2cBus, i2cAddr);
+    device->handler = handler;
+    device->contextPtr = contextPtr;
+    le_mutex_Unlock(Mutex);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the traffic which has passed over the simulated bus
+ */
+//--------------------------------------------------------------------------------------------------
+void sx1509Sim_GetStats
+(
+    sx1509Sim_Stats_t *stats
+)
+{
+    le_mutex_Lock(Mutex);
+    *stats = Stats;
+    le_mutex_Unlock(Mutex);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Clears the traffic statistics
+ */
+//--------------------------------------------------------------------------------------------------
+void sx1509Sim_ResetStats
+(
+    void
+)
+{
+    le_mutex_Lock(Mutex);
+    memset(&Stats, 0, sizeof(Stats));
+    le_mutex_Unlock(Mutex);
+}
+
+
+COMPONENT_INIT
+{
+    Mutex = le_mutex_CreateNonRecursive("sx1509Sim");
+}
@@ -0,0 +1,215 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file
+ *
+ * An in-process model of the SX1509 GPIO expander which can be installed as the I2C transport of
+ * the GPIO expander driver.  This allows the driver to be run, measured and tested on a host
+ * without the mangOH hardware.
+ *
+ * The model implements the register reset values, the software reset sequence, auto-increment of
+ * the register address during block transfers, edge detection into RegEventStatus and
+ * RegInterruptSource, assertion of the NINT output and its autoclear on a read of RegData unless
+ * disabled by bit 0 of RegMisc.  The time taken by each transfer on a real
+ * bus can optionally be emulated.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc. Use of this work is subject to license.
+ */
+//--------------------------------------------------------------------------------------------------
+#ifndef SX1509_SIM_H
+#define SX1509_SIM_H
+
+#include "legato.h"
+#include "gpioExpanderTransport.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Function called when the NINT output of a simulated device is asserted.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*sx1509Sim_InterruptHandlerFunc_t)
+(
+    void *contextPtr  ///< A pointer to data that was provided when the handler was set.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Traffic which has passed over the simulated bus.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t transactions; ///< Number of transfers, each of which starts with a START condition
+    uint32_t bytes;        ///< Number of bytes on the bus including address and register bytes
+    uint64_t busTimeNs;    ///< Time the transfers would have occupied the bus at the set speed
+    uint32_t syscalls;     ///< System calls the i2c-dev transport would have made for the same
+                           ///  operations: open and I2C_SLAVE_FORCE for each open, one ioctl for
+                           ///  each transfer and one close for each close.
+} sx1509Sim_Stats_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the transport which accesses the simulated devices.  Pass it to
+ * gpioExpander_SetI2cTransport() to run the driver against the simulator.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED const gpioExpander_I2cTransport_t *sx1509Sim_GetTransport
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds a simulated SX1509 in its reset state.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_DUPLICATE if a device already exists at the address
+ *      - LE_NO_MEMORY if the maximum number of devices has been reached
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t sx1509Sim_AddDevice
+(
+    uint8_t i2cBus,  ///< [IN] I2C bus the device is on
+    uint8_t i2cAddr  ///< [IN] I2C address of the device
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the speed of the simulated bus.  Each transfer busy-waits for as long as it would take on a
+ * real bus, eg. 100000 or 400000 for standard and fast mode.  A speed of 0 disables the emulation
+ * and transfers complete immediately.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void sx1509Sim_SetBusSpeed
+(
+    uint32_t hz  ///< [IN] SCL frequency in Hz
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Drives the pins of a simulated device from outside.  Pins configured as inputs take on the given
+ * level, which may cause events and assert NINT.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void sx1509Sim_SetInputs
+(
+    uint8_t i2cBus,   ///< [IN] I2C bus the device is on
+    uint8_t i2cAddr,  ///< [IN] I2C address of the device
+    uint16_t levels   ///< [IN] Bit n is the level applied to IO n
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Drives the pins of a simulated device from outside once its events are next cleared, as if the
+ * GPIOs changed again while the interrupt was being serviced.  DATA read after the events were
+ * cleared then no longer holds the levels which caused them.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void sx1509Sim_SetInputsOnClear
+(
+    uint8_t i2cBus,   ///< [IN] I2C bus the device is on
+    uint8_t i2cAddr,  ///< [IN] I2C address of the device
+    uint16_t levels   ///< [IN] Bit n is the level applied to IO n
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reports a key press from the keypad engine of a simulated device.  The key is latched into
+ * RegKeyData1 and RegKeyData2 and NINT is asserted until either register is read.  A register
+ * which has been read reports no key.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_NOT_PERMITTED if the keypad engine is off or the key is outside of the keypad
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t sx1509Sim_PressKey
+(
+    uint8_t i2cBus,   ///< [IN] I2C bus the device is on
+    uint8_t i2cAddr,  ///< [IN] I2C address of the device
+    uint8_t row,      ///< [IN] Row of the key, driven by IO row
+    uint8_t column    ///< [IN] Column of the key, read on IO 8 + column
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the level of the pins of a simulated device.
+ *
+ * @return
+ *      Bit n is the level of IO n
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED uint16_t sx1509Sim_GetPinLevels
+(
+    uint8_t i2cBus,   ///< [IN] I2C bus the device is on
+    uint8_t i2cAddr   ///< [IN] I2C address of the device
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads a register of a simulated device without going through the simulated bus.
+ *
+ * @return
+ *      The value of the register
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED uint8_t sx1509Sim_PeekReg
+(
+    uint8_t i2cBus,   ///< [IN] I2C bus the device is on
+    uint8_t i2cAddr,  ///< [IN] I2C address of the device
+    uint8_t reg       ///< [IN] Register to read
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether the NINT output of a simulated device is asserted.
+ *
+ * @return
+ *      true if NINT is asserted (low)
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED bool sx1509Sim_IsInterruptAsserted
+(
+    uint8_t i2cBus,   ///< [IN] I2C bus the device is on
+    uint8_t i2cAddr   ///< [IN] I2C address of the device
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the function to be called when NINT of a simulated device becomes asserted.  The function
+ * is called from the thread which caused the assertion and without any locks held, so it may
+ * access the device.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void sx1509Sim_SetInterruptHandler
+(
+    uint8_t i2cBus,                            ///< [IN] I2C bus the device is on
+    uint8_t i2cAddr,                           ///< [IN] I2C address of the device
+    sx1509Sim_InterruptHandlerFunc_t handler,  ///< [IN] Function to call or NULL
+    void *contextPtr                           ///< [IN] Passed to the handler
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the traffic which has passed over the simulated bus since the last call to
+ * sx1509Sim_ResetStats().
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void sx1509Sim_GetStats
+(
+    sx1509Sim_Stats_t *stats  ///< [OUT] Traffic statistics
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Clears the traffic statistics.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void sx1509Sim_ResetStats
+(
+    void
+);
+
+#endif // SX1509_SIM_H
@@ -0,0 +1,169 @@
+/**
+ * @file
+ *
+ * Reads the GPIO state page published by the GPIO expander service.  See
+ * gpioExpanderStateClient.h.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc. Use of this work is subject to license.
+ */
+
+#include "legato.h"
+#include "gpioExpanderStatePage.h"
+#include "gpioExpanderStateClient.h"
+#include <sys/mman.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The page mapped read-only by gpioExpanderStateClient_Open() or NULL.
+ */
+//--------------------------------------------------------------------------------------------------
+static const gpioExpanderStatePage_t *StatePage;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maps the page published by the service
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_UNAVAILABLE
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpanderStateClient_Open
+(
+    void
+)
+{
+    if (StatePage != NULL)
+    {
+        return LE_OK;
+    }
+
+    const int fd = shm_open(GPIO_EXPANDER_STATE_PAGE_NAME, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        return (errno == ENOENT) ? LE_UNAVAILABLE : LE_FAULT;
+    }
+
+    struct stat statBuf;
+    void *page = MAP_FAILED;
+    if (fstat(fd, &statBuf) == 0 && statBuf.st_size >= sizeof(gpioExpanderStatePage_t))
+    {
+        page = mmap(NULL, sizeof(gpioExpanderStatePage_t), PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (page == MAP_FAILED)
+    {
+        LE_ERROR("Couldn't map GPIO expander state page");
+        return LE_FAULT;
+    }
+
+    const gpioExpanderStatePage_t *statePage = page;
+    if (__atomic_load_n(&statePage->magic, __ATOMIC_ACQUIRE) != GPIO_EXPANDER_STATE_PAGE_MAGIC ||
+        statePage->version != GPIO_EXPANDER_STATE_PAGE_VERSION)
+    {
+        LE_ERROR("GPIO expander state page has an unexpected layout");
+        munmap(page, sizeof(gpioExpanderStatePage_t));
+        return LE_FAULT;
+    }
+
+    StatePage = statePage;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads the published value of all GPIOs of an expander
+ *
+ * The port is copied and the copy is retried if the service updated the port in the meantime, so
+ * the values returned are always a consistent snapshot.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_NOT_FOUND
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpanderStateClient_ReadPort
+(
+    uint8_t expander,
+    uint16_t *valuePtr,
+    uint16_t *validPtr,
+    uint64_t *updateUsPtr
+)
+{
+    LE_ASSERT(StatePage != NULL);
+    if (expander < 1 || expander > StatePage->numPorts)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    const gpioExpanderStatePage_Port_t *port = &StatePage->ports[expander - 1];
+    uint32_t sequence;
+    uint16_t value;
+    uint16_t valid;
+    uint64_t updateUs;
+    do
+    {
+        sequence = __atomic_load_n(&port->sequence, __ATOMIC_ACQUIRE);
+        value = __atomic_load_n(&port->value, __ATOMIC_RELAXED);
+        valid = __atomic_load_n(&port->validMask, __ATOMIC_RELAXED);
+        updateUs = __atomic_load_n(&port->updateTimeUs, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while ((sequence & 1) != 0 || __atomic_load_n(&port->sequence, __ATOMIC_RELAXED) != sequence);
+
+    *valuePtr = value;
+    if (validPtr != NULL)
+    {
+        *validPtr = valid;
+    }
+    if (updateUsPtr != NULL)
+    {
+        *updateUsPtr = updateUs;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads the published value of a single GPIO
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_NOT_FOUND
+ *      - LE_UNAVAILABLE
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t gpioExpanderStateClient_Read
+(
+    uint8_t expander,
+    uint8_t pin,
+    bool *activePtr
+)
+{
+    if (pin >= 16)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    uint16_t value;
+    uint16_t valid;
+    const le_result_t r = gpioExpanderStateClient_ReadPort(expander, &value, &valid, NULL);
+    if (r != LE_OK)
+    {
+        return r;
+    }
+    if ((valid & (1 << pin)) == 0)
+    {
+        return LE_UNAVAILABLE;
+    }
+
+    *activePtr = ((value >> pin) & 1) == 1;
+    return LE_OK;
+}
+
+COMPONENT_INIT
+{
+}
@@ -0,0 +1,83 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file
+ *
+ * Client library which reads the state of the expander GPIOs from the shared memory page published
+ * by the GPIO expander service.  Reads are lock-free and involve neither IPC nor I2C, so they are
+ * suitable for clients which poll.  The values are those of the last interrupt, read or write
+ * handled by the service, so an input which doesn't generate interrupts may be stale.
+ *
+ * Add this component to an executable of the client app.  A sandboxed app also needs access to
+ * the page, eg.
+ *
+ * @code
+ * requires:
+ * {
+ *     dir:
+ *     {
+ *         /dev/shm  /dev/
+ *     }
+ * }
+ * @endcode
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc. Use of this work is subject to license.
+ */
+//--------------------------------------------------------------------------------------------------
+#ifndef GPIO_EXPANDER_STATE_CLIENT_H
+#define GPIO_EXPANDER_STATE_CLIENT_H
+
+#include "legato.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maps the page published by the service.  Must be called before any of the read functions.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_UNAVAILABLE if the service hasn't published the page
+ *      - LE_FAULT if the page couldn't be mapped or has an unexpected layout
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpanderStateClient_Open
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads the published value of all GPIOs of an expander.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_NOT_FOUND if the expander isn't published
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpanderStateClient_ReadPort
+(
+    uint8_t expander,      ///< [IN] Expander number, numbered from 1 as in gpioExpander.api
+    uint16_t *valuePtr,    ///< [OUT] Bit n holds the value of GPIO n as le_gpio_Read() reports it
+    uint16_t *validPtr,    ///< [OUT] Bit n is set if the value of GPIO n is known.  May be NULL.
+    uint64_t *updateUsPtr  ///< [OUT] le_clk_GetRelativeTime() of the last update in microseconds.
+                           ///  May be NULL.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads the published value of a single GPIO.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_NOT_FOUND if the expander isn't published or the GPIO doesn't exist
+ *      - LE_UNAVAILABLE if the value of the GPIO isn't known yet
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t gpioExpanderStateClient_Read
+(
+    uint8_t expander,  ///< [IN] Expander number, numbered from 1 as in gpioExpander.api
+    uint8_t pin,       ///< [IN] GPIO number within the expander
+    bool *activePtr    ///< [OUT] true if the GPIO is active
+);
+
+#endif // GPIO_EXPANDER_STATE_CLIENT_H